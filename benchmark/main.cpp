@@ -11,6 +11,8 @@
 
 #include "xsimd_benchmark.hpp"
 #include <map>
+#include <string>
+#include <vector>
 
 void benchmark_operation()
 {
@@ -109,6 +111,40 @@ void benchmark_basic_math()
 #endif
 }
 
+void benchmark_algorithms()
+{
+    std::size_t size = 20003;
+    xsimd::run_benchmark_transform(xsimd::exp_fn(), std::cout, size, 1000);
+    xsimd::run_benchmark_transform(xsimd::sqrt_fn(), std::cout, size, 1000);
+    xsimd::run_benchmark_reduce(std::cout, size, 1000);
+    xsimd::run_benchmark_scan(std::cout, size, 1000);
+    xsimd::run_benchmark_minmax_element(std::cout, size, 1000);
+    xsimd::run_benchmark_sort(std::cout, size, 100);
+    xsimd::run_benchmark_copy_if(std::cout, size, 1000);
+}
+
+void benchmark_dispatch()
+{
+    std::size_t size = 20000;
+    xsimd::run_benchmark_dispatch(std::cout, size, 1000);
+}
+
+void benchmark_parallel()
+{
+    std::size_t size = 1 << 25;
+    xsimd::run_benchmark_parallel(xsimd::exp_fn(), std::cout, size, 10);
+    xsimd::run_benchmark_parallel(xsimd::log_fn(), std::cout, size, 10);
+}
+
+struct arch_name
+{
+    template <class Arch>
+    char const* operator()(Arch) const
+    {
+        return Arch::name();
+    }
+};
+
 int main(int argc, char* argv[])
 {
     const std::map<std::string, std::pair<std::string, void (*)()>> fn_map = {
@@ -119,41 +155,60 @@ int main(int argc, char* argv[])
         { "power", { "power", benchmark_power } },
         { "basic_math", { "basic math", benchmark_basic_math } },
         { "rounding", { "rounding", benchmark_rounding } },
+        { "algorithms", { "range algorithms", benchmark_algorithms } },
+        { "parallel", { "parallel range algorithms", benchmark_parallel } },
+        { "dispatch", { "dispatch overhead of", benchmark_dispatch } },
 #ifdef XSIMD_POLY_BENCHMARKS
         { "utils", { "polynomial evaluation", benchmark_poly_evaluation } },
 #endif
     };
 
-    if (argc > 1)
+    std::vector<std::string> names;
+    for (int i = 1; i < argc; ++i)
     {
-        if (std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h")
+        std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
         {
-            std::cout << "Available options:" << std::endl;
+            std::cout << "Available options:" << std::endl
+                      << "--arch <name>: run the vector benchmarks on <name>, or the best available architecture below it" << std::endl;
             for (auto const& kv : fn_map)
             {
                 std::cout << kv.first << ": run benchmark on " << kv.second.first << " functions" << std::endl;
             }
+            return 0;
         }
-        else
+        else if (arg == "--arch" || arg.compare(0, 7, "--arch=") == 0)
         {
-            std::cout << "############################" << std::endl
-                      << "# " << xsimd::default_arch::name() << std::endl
-                      << "############################" << std::endl;
-            for (int i = 1; i < argc; ++i)
+            std::string name = arg.size() > 6 ? arg.substr(7) : (i + 1 < argc ? argv[++i] : "");
+            if (!xsimd::force_architecture(name.c_str()))
             {
-                fn_map.at(argv[i]).second();
+                std::cerr << "unknown architecture: " << name << std::endl;
+                return 1;
             }
         }
+        else
+        {
+            names.push_back(arg);
+        }
     }
-    else
+
+    std::cout << "############################" << std::endl
+              << "# " << xsimd::default_arch::name() << std::endl
+              << "# dispatched: " << xsimd::dispatch(arch_name {})() << std::endl
+              << "############################" << std::endl;
+    if (names.empty())
     {
-        std::cout << "############################" << std::endl
-                  << "# " << xsimd::default_arch::name() << std::endl
-                  << "############################" << std::endl;
         for (auto const& kv : fn_map)
         {
             kv.second.second();
         }
     }
+    else
+    {
+        for (auto const& name : names)
+        {
+            fn_map.at(name).second();
+        }
+    }
     return 0;
 }
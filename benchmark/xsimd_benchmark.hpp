@@ -13,9 +13,13 @@
 #define XSIMD_BENCHMARK_HPP
 
 #include "xsimd/arch/xsimd_scalar.hpp"
+#include "xsimd/stl/algorithms.hpp"
+#include "xsimd/stl/parallel.hpp"
 #include "xsimd/xsimd.hpp"
+#include <algorithm>
 #include <chrono>
 #include <iostream>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -310,6 +314,36 @@ namespace xsimd
         return t_res;
     }
 
+    // The simd benchmarks run on the architecture picked by xsimd::dispatch,
+    // so that xsimd::force_architecture (--arch) applies to them. Architectures
+    // without registers for T, such as 32-bit neon for double, fall back to
+    // the default one.
+    template <class T, class Arch>
+    using benchmark_arch = typename std::conditional<types::has_simd_register<T, Arch>::value, Arch, default_arch>::type;
+
+    template <class T, class Arch>
+    using benchmark_batch = batch<T, benchmark_arch<T, Arch>>;
+
+    template <class T>
+    struct simd_benchmark
+    {
+        template <class Arch, class... Args>
+        duration_type operator()(Arch, Args&&... args) const
+        {
+            return benchmark_simd<benchmark_batch<T, Arch>>(std::forward<Args>(args)...);
+        }
+    };
+
+    template <class T>
+    struct simd_unrolled_benchmark
+    {
+        template <class Arch, class... Args>
+        duration_type operator()(Arch, Args&&... args) const
+        {
+            return benchmark_simd_unrolled<benchmark_batch<T, Arch>>(std::forward<Args>(args)...);
+        }
+    };
+
     template <class F, class OS>
     void run_benchmark_1op(F f, OS& out, std::size_t size, std::size_t iter, init_method init = init_method::classic)
     {
@@ -337,11 +371,11 @@ namespace xsimd
         duration_type t_double_scalar = benchmark_scalar(f, d_lhs, d_res, iter);
 #endif
 
-        duration_type t_float_vector = benchmark_simd<batch<float>>(f, f_lhs, f_res, iter);
-        duration_type t_float_vector_u = benchmark_simd_unrolled<batch<float>>(f, f_lhs, f_res, iter);
+        duration_type t_float_vector = xsimd::dispatch(simd_benchmark<float> {})(f, f_lhs, f_res, iter);
+        duration_type t_float_vector_u = xsimd::dispatch(simd_unrolled_benchmark<float> {})(f, f_lhs, f_res, iter);
 #if !XSIMD_WITH_NEON || XSIMD_WITH_NEON64
-        duration_type t_double_vector = benchmark_simd<batch<double>>(f, d_lhs, d_res, iter);
-        duration_type t_double_vector_u = benchmark_simd_unrolled<batch<double>>(f, d_lhs, d_res, iter);
+        duration_type t_double_vector = xsimd::dispatch(simd_benchmark<double> {})(f, d_lhs, d_res, iter);
+        duration_type t_double_vector_u = xsimd::dispatch(simd_unrolled_benchmark<double> {})(f, d_lhs, d_res, iter);
 #endif
 
         out << "============================" << std::endl;
@@ -372,13 +406,13 @@ namespace xsimd
         init_benchmark(d_lhs, d_rhs, d_res, size);
 
         duration_type t_float_scalar = benchmark_scalar(f, f_lhs, f_rhs, f_res, iter);
-        duration_type t_float_vector = benchmark_simd<batch<float>>(f, f_lhs, f_rhs, f_res, iter);
-        duration_type t_float_vector_u = benchmark_simd_unrolled<batch<float>>(f, f_lhs, f_rhs, f_res, iter);
+        duration_type t_float_vector = xsimd::dispatch(simd_benchmark<float> {})(f, f_lhs, f_rhs, f_res, iter);
+        duration_type t_float_vector_u = xsimd::dispatch(simd_unrolled_benchmark<float> {})(f, f_lhs, f_rhs, f_res, iter);
 
         duration_type t_double_scalar = benchmark_scalar(f, d_lhs, d_rhs, d_res, iter);
 #if !XSIMD_WITH_NEON || XSIMD_WITH_NEON64
-        duration_type t_double_vector = benchmark_simd<batch<double>>(f, d_lhs, d_rhs, d_res, iter);
-        duration_type t_double_vector_u = benchmark_simd_unrolled<batch<double>>(f, d_lhs, d_rhs, d_res, iter);
+        duration_type t_double_vector = xsimd::dispatch(simd_benchmark<double> {})(f, d_lhs, d_rhs, d_res, iter);
+        duration_type t_double_vector_u = xsimd::dispatch(simd_unrolled_benchmark<double> {})(f, d_lhs, d_rhs, d_res, iter);
 #endif
 
         out << "============================" << std::endl;
@@ -404,12 +438,12 @@ namespace xsimd
         init_benchmark(d_op0, d_op1, d_op2, d_res, size);
 
         duration_type t_float_scalar = benchmark_scalar(f, f_op0, f_op1, f_op2, f_res, iter);
-        duration_type t_float_vector = benchmark_simd<batch<float>>(f, f_op0, f_op1, f_op2, f_res, iter);
-        duration_type t_float_vector_u = benchmark_simd_unrolled<batch<float>>(f, f_op0, f_op1, f_op2, f_res, iter);
+        duration_type t_float_vector = xsimd::dispatch(simd_benchmark<float> {})(f, f_op0, f_op1, f_op2, f_res, iter);
+        duration_type t_float_vector_u = xsimd::dispatch(simd_unrolled_benchmark<float> {})(f, f_op0, f_op1, f_op2, f_res, iter);
         duration_type t_double_scalar = benchmark_scalar(f, d_op0, d_op1, d_op2, d_res, iter);
 #if !XSIMD_WITH_NEON || XSIMD_WITH_NEON64
-        duration_type t_double_vector = benchmark_simd<batch<double>>(f, d_op0, d_op1, d_op2, d_res, iter);
-        duration_type t_double_vector_u = benchmark_simd_unrolled<batch<double>>(f, d_op0, d_op1, d_op2, d_res, iter);
+        duration_type t_double_vector = xsimd::dispatch(simd_benchmark<double> {})(f, d_op0, d_op1, d_op2, d_res, iter);
+        duration_type t_double_vector_u = xsimd::dispatch(simd_unrolled_benchmark<double> {})(f, d_op0, d_op1, d_op2, d_res, iter);
 #endif
 
         out << "============================" << std::endl;
@@ -425,6 +459,513 @@ namespace xsimd
         out << "============================" << std::endl;
     }
 
+    /**************************
+     * range algorithms bench *
+     **************************/
+
+    template <class F, class V>
+    duration_type benchmark_std_transform(F f, V& lhs, V& res, std::size_t number)
+    {
+        using value_type = typename V::value_type;
+        duration_type t_res = duration_type::max();
+        for (std::size_t count = 0; count < number; ++count)
+        {
+            auto start = std::chrono::steady_clock::now();
+            std::transform(lhs.begin(), lhs.end(), res.begin(), [&f](value_type x)
+                           { return f(x); });
+            auto end = std::chrono::steady_clock::now();
+            auto tmp = end - start;
+            t_res = tmp < t_res ? tmp : t_res;
+        }
+        return t_res;
+    }
+
+    // offset shifts the input range so that the loads cannot be aligned
+    // The xsimd algorithms benchmarks are functors, called through
+    // xsimd::dispatch so that xsimd::force_architecture (--arch) applies.
+    template <std::size_t Unroll>
+    struct benchmark_xsimd_transform
+    {
+        template <class Arch, class F, class V>
+        duration_type operator()(Arch, F f, V& lhs, V& res, std::size_t offset, std::size_t number) const
+        {
+            duration_type t_res = duration_type::max();
+            for (std::size_t count = 0; count < number; ++count)
+            {
+                auto start = std::chrono::steady_clock::now();
+                xsimd::transform<benchmark_arch<typename V::value_type, Arch>, Unroll>(lhs.begin() + offset, lhs.end(), res.begin(), f);
+                auto end = std::chrono::steady_clock::now();
+                auto tmp = end - start;
+                t_res = tmp < t_res ? tmp : t_res;
+            }
+            return t_res;
+        }
+    };
+
+    template <class V>
+    duration_type benchmark_std_reduce(V& lhs, typename V::value_type& res, std::size_t number)
+    {
+        using value_type = typename V::value_type;
+        duration_type t_res = duration_type::max();
+        for (std::size_t count = 0; count < number; ++count)
+        {
+            auto start = std::chrono::steady_clock::now();
+            res += std::accumulate(lhs.begin(), lhs.end(), value_type(0));
+            auto end = std::chrono::steady_clock::now();
+            auto tmp = end - start;
+            t_res = tmp < t_res ? tmp : t_res;
+        }
+        return t_res;
+    }
+
+    template <std::size_t Unroll>
+    struct benchmark_xsimd_reduce
+    {
+        template <class Arch, class V>
+        duration_type operator()(Arch, V& lhs, typename V::value_type& res, std::size_t offset, std::size_t number) const
+        {
+            using value_type = typename V::value_type;
+            duration_type t_res = duration_type::max();
+            for (std::size_t count = 0; count < number; ++count)
+            {
+                auto start = std::chrono::steady_clock::now();
+                res += xsimd::reduce<benchmark_arch<value_type, Arch>, Unroll>(lhs.begin() + offset, lhs.end(), value_type(0));
+                auto end = std::chrono::steady_clock::now();
+                auto tmp = end - start;
+                t_res = tmp < t_res ? tmp : t_res;
+            }
+            return t_res;
+        }
+    };
+
+    template <class V>
+    duration_type benchmark_std_scan(V& lhs, V& res, std::size_t number)
+    {
+        duration_type t_res = duration_type::max();
+        for (std::size_t count = 0; count < number; ++count)
+        {
+            auto start = std::chrono::steady_clock::now();
+            std::partial_sum(lhs.begin(), lhs.end(), res.begin());
+            auto end = std::chrono::steady_clock::now();
+            auto tmp = end - start;
+            t_res = tmp < t_res ? tmp : t_res;
+        }
+        return t_res;
+    }
+
+    struct benchmark_xsimd_scan
+    {
+        template <class Arch, class V>
+        duration_type operator()(Arch, V& lhs, V& res, std::size_t number) const
+        {
+            duration_type t_res = duration_type::max();
+            for (std::size_t count = 0; count < number; ++count)
+            {
+                auto start = std::chrono::steady_clock::now();
+                xsimd::inclusive_scan<benchmark_arch<typename V::value_type, Arch>>(lhs.begin(), lhs.end(), res.begin());
+                auto end = std::chrono::steady_clock::now();
+                auto tmp = end - start;
+                t_res = tmp < t_res ? tmp : t_res;
+            }
+            return t_res;
+        }
+    };
+
+    template <class V>
+    duration_type benchmark_std_minmax_element(V& lhs, std::size_t& res, std::size_t number)
+    {
+        duration_type t_res = duration_type::max();
+        for (std::size_t count = 0; count < number; ++count)
+        {
+            auto start = std::chrono::steady_clock::now();
+            auto mm = std::minmax_element(lhs.begin(), lhs.end());
+            res += static_cast<std::size_t>(mm.second - mm.first);
+            auto end = std::chrono::steady_clock::now();
+            auto tmp = end - start;
+            t_res = tmp < t_res ? tmp : t_res;
+        }
+        return t_res;
+    }
+
+    struct benchmark_xsimd_minmax_element
+    {
+        template <class Arch, class V>
+        duration_type operator()(Arch, V& lhs, std::size_t& res, std::size_t number) const
+        {
+            duration_type t_res = duration_type::max();
+            for (std::size_t count = 0; count < number; ++count)
+            {
+                auto start = std::chrono::steady_clock::now();
+                auto mm = xsimd::minmax_element<benchmark_arch<typename V::value_type, Arch>>(lhs.begin(), lhs.end());
+                res += static_cast<std::size_t>(mm.second - mm.first);
+                auto end = std::chrono::steady_clock::now();
+                auto tmp = end - start;
+                t_res = tmp < t_res ? tmp : t_res;
+            }
+            return t_res;
+        }
+    };
+
+    template <class V>
+    duration_type benchmark_std_sort(V const& lhs, V& res, std::size_t number)
+    {
+        duration_type t_res = duration_type::max();
+        for (std::size_t count = 0; count < number; ++count)
+        {
+            res = lhs;
+            auto start = std::chrono::steady_clock::now();
+            std::sort(res.begin(), res.end());
+            auto end = std::chrono::steady_clock::now();
+            auto tmp = end - start;
+            t_res = tmp < t_res ? tmp : t_res;
+        }
+        return t_res;
+    }
+
+    struct benchmark_xsimd_sort
+    {
+        template <class Arch, class V>
+        duration_type operator()(Arch, V const& lhs, V& res, std::size_t number) const
+        {
+            duration_type t_res = duration_type::max();
+            for (std::size_t count = 0; count < number; ++count)
+            {
+                res = lhs;
+                auto start = std::chrono::steady_clock::now();
+                xsimd::sort<benchmark_arch<typename V::value_type, Arch>>(res.begin(), res.end());
+                auto end = std::chrono::steady_clock::now();
+                auto tmp = end - start;
+                t_res = tmp < t_res ? tmp : t_res;
+            }
+            return t_res;
+        }
+    };
+
+    template <class V>
+    duration_type benchmark_std_copy_if(V const& lhs, V& res, std::size_t number)
+    {
+        using value_type = typename V::value_type;
+        duration_type t_res = duration_type::max();
+        for (std::size_t count = 0; count < number; ++count)
+        {
+            auto start = std::chrono::steady_clock::now();
+            std::copy_if(lhs.begin(), lhs.end(), res.begin(), [](value_type x)
+                         { return x > value_type(0); });
+            auto end = std::chrono::steady_clock::now();
+            auto tmp = end - start;
+            t_res = tmp < t_res ? tmp : t_res;
+        }
+        return t_res;
+    }
+
+    struct benchmark_xsimd_copy_if
+    {
+        template <class Arch, class V>
+        duration_type operator()(Arch, V const& lhs, V& res, std::size_t number) const
+        {
+            using arch_type = benchmark_arch<typename V::value_type, Arch>;
+            using batch_type = batch<typename V::value_type, arch_type>;
+            duration_type t_res = duration_type::max();
+            for (std::size_t count = 0; count < number; ++count)
+            {
+                auto start = std::chrono::steady_clock::now();
+                xsimd::copy_if<arch_type>(lhs.begin(), lhs.end(), res.begin(), [](batch_type const& x)
+                                          { return x > batch_type(0); });
+                auto end = std::chrono::steady_clock::now();
+                auto tmp = end - start;
+                t_res = tmp < t_res ? tmp : t_res;
+            }
+            return t_res;
+        }
+    };
+
+    template <class F, class OS>
+    void run_benchmark_transform(F f, OS& out, std::size_t size, std::size_t iter)
+    {
+        bench_vector<float> f_lhs, f_rhs, f_res;
+        bench_vector<double> d_lhs, d_rhs, d_res;
+
+        init_benchmark(f_lhs, f_rhs, f_res, size);
+        init_benchmark(d_lhs, d_rhs, d_res, size);
+
+        duration_type t_float_scalar = benchmark_std_transform(f, f_lhs, f_res, iter);
+        duration_type t_float_vector = xsimd::dispatch(benchmark_xsimd_transform<1> {})(f, f_lhs, f_res, 0, iter);
+        duration_type t_float_vector_u = xsimd::dispatch(benchmark_xsimd_transform<4> {})(f, f_lhs, f_res, 0, iter);
+        duration_type t_float_vector_m = xsimd::dispatch(benchmark_xsimd_transform<4> {})(f, f_lhs, f_res, 1, iter);
+        duration_type t_double_scalar = benchmark_std_transform(f, d_lhs, d_res, iter);
+        duration_type t_double_vector = xsimd::dispatch(benchmark_xsimd_transform<1> {})(f, d_lhs, d_res, 0, iter);
+        duration_type t_double_vector_u = xsimd::dispatch(benchmark_xsimd_transform<4> {})(f, d_lhs, d_res, 0, iter);
+        duration_type t_double_vector_m = xsimd::dispatch(benchmark_xsimd_transform<4> {})(f, d_lhs, d_res, 1, iter);
+
+        out << "============================" << std::endl;
+        out << "transform " << f.name() << std::endl;
+        out << "std float         : " << t_float_scalar.count() << "ms" << std::endl;
+        out << "xsimd float       : " << t_float_vector.count() << "ms" << std::endl;
+        out << "xsimd float unr   : " << t_float_vector_u.count() << "ms" << std::endl;
+        out << "xsimd float misal : " << t_float_vector_m.count() << "ms" << std::endl;
+        out << "std double        : " << t_double_scalar.count() << "ms" << std::endl;
+        out << "xsimd double      : " << t_double_vector.count() << "ms" << std::endl;
+        out << "xsimd double unr  : " << t_double_vector_u.count() << "ms" << std::endl;
+        out << "xsimd double misal: " << t_double_vector_m.count() << "ms" << std::endl;
+        out << "============================" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_reduce(OS& out, std::size_t size, std::size_t iter)
+    {
+        bench_vector<float> f_lhs, f_rhs, f_res;
+        bench_vector<double> d_lhs, d_rhs, d_res;
+
+        init_benchmark(f_lhs, f_rhs, f_res, size);
+        init_benchmark(d_lhs, d_rhs, d_res, size);
+
+        // results are accumulated so that the reductions are not optimized out
+        float f_sum = 0;
+        double d_sum = 0;
+        duration_type t_float_scalar = benchmark_std_reduce(f_lhs, f_sum, iter);
+        duration_type t_float_vector = xsimd::dispatch(benchmark_xsimd_reduce<1> {})(f_lhs, f_sum, 0, iter);
+        duration_type t_float_vector_u = xsimd::dispatch(benchmark_xsimd_reduce<4> {})(f_lhs, f_sum, 0, iter);
+        duration_type t_float_vector_m = xsimd::dispatch(benchmark_xsimd_reduce<4> {})(f_lhs, f_sum, 1, iter);
+        duration_type t_double_scalar = benchmark_std_reduce(d_lhs, d_sum, iter);
+        duration_type t_double_vector = xsimd::dispatch(benchmark_xsimd_reduce<1> {})(d_lhs, d_sum, 0, iter);
+        duration_type t_double_vector_u = xsimd::dispatch(benchmark_xsimd_reduce<4> {})(d_lhs, d_sum, 0, iter);
+        duration_type t_double_vector_m = xsimd::dispatch(benchmark_xsimd_reduce<4> {})(d_lhs, d_sum, 1, iter);
+
+        out << "============================" << std::endl;
+        out << "reduce (" << f_sum + d_sum << ")" << std::endl;
+        out << "std float         : " << t_float_scalar.count() << "ms" << std::endl;
+        out << "xsimd float       : " << t_float_vector.count() << "ms" << std::endl;
+        out << "xsimd float unr   : " << t_float_vector_u.count() << "ms" << std::endl;
+        out << "xsimd float misal : " << t_float_vector_m.count() << "ms" << std::endl;
+        out << "std double        : " << t_double_scalar.count() << "ms" << std::endl;
+        out << "xsimd double      : " << t_double_vector.count() << "ms" << std::endl;
+        out << "xsimd double unr  : " << t_double_vector_u.count() << "ms" << std::endl;
+        out << "xsimd double misal: " << t_double_vector_m.count() << "ms" << std::endl;
+        out << "============================" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_scan(OS& out, std::size_t size, std::size_t iter)
+    {
+        bench_vector<float> f_lhs, f_rhs, f_res;
+        bench_vector<int32_t> i_lhs(size), i_res(size);
+
+        init_benchmark(f_lhs, f_rhs, f_res, size);
+        for (std::size_t i = 0; i < size; ++i)
+            i_lhs[i] = static_cast<int32_t>(i % 17);
+
+        duration_type t_float_scalar = benchmark_std_scan(f_lhs, f_res, iter);
+        duration_type t_float_vector = xsimd::dispatch(benchmark_xsimd_scan {})(f_lhs, f_res, iter);
+        duration_type t_int_scalar = benchmark_std_scan(i_lhs, i_res, iter);
+        duration_type t_int_vector = xsimd::dispatch(benchmark_xsimd_scan {})(i_lhs, i_res, iter);
+
+        out << "============================" << std::endl;
+        out << "inclusive_scan" << std::endl;
+        out << "std float         : " << t_float_scalar.count() << "ms" << std::endl;
+        out << "xsimd float       : " << t_float_vector.count() << "ms" << std::endl;
+        out << "std int32         : " << t_int_scalar.count() << "ms" << std::endl;
+        out << "xsimd int32       : " << t_int_vector.count() << "ms" << std::endl;
+        out << "============================" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_minmax_element(OS& out, std::size_t size, std::size_t iter)
+    {
+        bench_vector<float> f_lhs, f_rhs, f_res;
+        bench_vector<double> d_lhs, d_rhs, d_res;
+
+        init_benchmark(f_lhs, f_rhs, f_res, size);
+        init_benchmark(d_lhs, d_rhs, d_res, size);
+
+        // positions are accumulated so that the searches are not optimized out
+        std::size_t pos = 0;
+        duration_type t_float_scalar = benchmark_std_minmax_element(f_lhs, pos, iter);
+        duration_type t_float_vector = xsimd::dispatch(benchmark_xsimd_minmax_element {})(f_lhs, pos, iter);
+        duration_type t_double_scalar = benchmark_std_minmax_element(d_lhs, pos, iter);
+        duration_type t_double_vector = xsimd::dispatch(benchmark_xsimd_minmax_element {})(d_lhs, pos, iter);
+
+        out << "============================" << std::endl;
+        out << "minmax_element (" << pos << ")" << std::endl;
+        out << "std float         : " << t_float_scalar.count() << "ms" << std::endl;
+        out << "xsimd float       : " << t_float_vector.count() << "ms" << std::endl;
+        out << "std double        : " << t_double_scalar.count() << "ms" << std::endl;
+        out << "xsimd double      : " << t_double_vector.count() << "ms" << std::endl;
+        out << "============================" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_sort(OS& out, std::size_t size, std::size_t iter)
+    {
+        bench_vector<float> f_lhs(size), f_res(size);
+        bench_vector<int32_t> i_lhs(size), i_res(size);
+        uint32_t state = 12345;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            state = state * 1103515245u + 12345u;
+            f_lhs[i] = static_cast<float>(state >> 8);
+            i_lhs[i] = static_cast<int32_t>(state);
+        }
+
+        duration_type t_float_scalar = benchmark_std_sort(f_lhs, f_res, iter);
+        duration_type t_float_vector = xsimd::dispatch(benchmark_xsimd_sort {})(f_lhs, f_res, iter);
+        duration_type t_int_scalar = benchmark_std_sort(i_lhs, i_res, iter);
+        duration_type t_int_vector = xsimd::dispatch(benchmark_xsimd_sort {})(i_lhs, i_res, iter);
+
+        out << "============================" << std::endl;
+        out << "sort" << std::endl;
+        out << "std float         : " << t_float_scalar.count() << "ms" << std::endl;
+        out << "xsimd float       : " << t_float_vector.count() << "ms" << std::endl;
+        out << "std int32         : " << t_int_scalar.count() << "ms" << std::endl;
+        out << "xsimd int32       : " << t_int_vector.count() << "ms" << std::endl;
+        out << "============================" << std::endl;
+    }
+
+    template <class OS>
+    void run_benchmark_copy_if(OS& out, std::size_t size, std::size_t iter)
+    {
+        bench_vector<float> f_lhs(size), f_res(size);
+        bench_vector<int32_t> i_lhs(size), i_res(size);
+        uint32_t state = 12345;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            // about half of the elements are selected, in random order
+            state = state * 1103515245u + 12345u;
+            i_lhs[i] = static_cast<int32_t>(state);
+            f_lhs[i] = static_cast<float>(i_lhs[i]);
+        }
+
+        duration_type t_float_scalar = benchmark_std_copy_if(f_lhs, f_res, iter);
+        duration_type t_float_vector = xsimd::dispatch(benchmark_xsimd_copy_if {})(f_lhs, f_res, iter);
+        duration_type t_int_scalar = benchmark_std_copy_if(i_lhs, i_res, iter);
+        duration_type t_int_vector = xsimd::dispatch(benchmark_xsimd_copy_if {})(i_lhs, i_res, iter);
+
+        out << "============================" << std::endl;
+        out << "copy_if" << std::endl;
+        out << "std float         : " << t_float_scalar.count() << "ms" << std::endl;
+        out << "xsimd float       : " << t_float_vector.count() << "ms" << std::endl;
+        out << "std int32         : " << t_int_scalar.count() << "ms" << std::endl;
+        out << "xsimd int32       : " << t_int_vector.count() << "ms" << std::endl;
+        out << "============================" << std::endl;
+    }
+
+    template <class F, class V>
+    duration_type benchmark_parallel_transform(F f, V& lhs, V& res, std::size_t threads, std::size_t number)
+    {
+        parallel::thread_pool pool(threads);
+        duration_type t_res = duration_type::max();
+        for (std::size_t count = 0; count < number; ++count)
+        {
+            auto start = std::chrono::steady_clock::now();
+            parallel::transform(pool, lhs.begin(), lhs.end(), res.begin(), f);
+            auto end = std::chrono::steady_clock::now();
+            auto tmp = end - start;
+            t_res = tmp < t_res ? tmp : t_res;
+        }
+        return t_res;
+    }
+
+    template <class V>
+    duration_type benchmark_parallel_reduce(V& lhs, typename V::value_type& res, std::size_t threads, std::size_t number)
+    {
+        using value_type = typename V::value_type;
+        parallel::thread_pool pool(threads);
+        duration_type t_res = duration_type::max();
+        for (std::size_t count = 0; count < number; ++count)
+        {
+            auto start = std::chrono::steady_clock::now();
+            res += parallel::reduce(pool, lhs.begin(), lhs.end(), value_type(0));
+            auto end = std::chrono::steady_clock::now();
+            auto tmp = end - start;
+            t_res = tmp < t_res ? tmp : t_res;
+        }
+        return t_res;
+    }
+
+    // measures the scaling with the number of threads, doubling it up to
+    // the hardware concurrency
+    template <class F, class OS>
+    void run_benchmark_parallel(F f, OS& out, std::size_t size, std::size_t iter)
+    {
+        bench_vector<float> f_lhs, f_rhs, f_res;
+        init_benchmark(f_lhs, f_rhs, f_res, size);
+
+        std::size_t max_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+        float f_sum = 0;
+        out << "============================" << std::endl;
+        out << "parallel " << f.name() << " / reduce" << std::endl;
+        for (std::size_t threads = 1;; threads = std::min(2 * threads, max_threads))
+        {
+            duration_type t_transform = benchmark_parallel_transform(f, f_lhs, f_res, threads, iter);
+            duration_type t_reduce = benchmark_parallel_reduce(f_lhs, f_sum, threads, iter);
+            out << threads << " threads: " << t_transform.count() << "ms / " << t_reduce.count() << "ms" << std::endl;
+            if (threads == max_threads)
+                break;
+        }
+        out << "(" << f_sum << ")" << std::endl;
+        out << "============================" << std::endl;
+    }
+
+    // a kernel small enough for the cost of the dispatch to show
+    struct dispatch_sum_fn
+    {
+        template <class Arch>
+        float operator()(Arch, float const* data) const noexcept
+        {
+            return reduce_add(batch<float, Arch>::load_unaligned(data));
+        }
+    };
+
+    template <class F>
+    duration_type benchmark_dispatch_calls(F&& f, bench_vector<float> const& data, float& res, std::size_t number)
+    {
+        constexpr std::size_t width = batch<float>::size;
+        duration_type t_res = duration_type::max();
+        for (std::size_t count = 0; count < number; ++count)
+        {
+            float acc = 0.f;
+            auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i + width <= data.size(); ++i)
+                acc += f(&data[i]);
+            auto end = std::chrono::steady_clock::now();
+            res += acc;
+            auto tmp = end - start;
+            t_res = tmp < t_res ? tmp : t_res;
+        }
+        return t_res;
+    }
+
+    template <class OS>
+    void run_benchmark_dispatch(OS& out, std::size_t size, std::size_t iter)
+    {
+        bench_vector<float> f_lhs, f_rhs, f_res;
+        init_benchmark(f_lhs, f_rhs, f_res, size);
+        float res = 0.f;
+
+        auto dispatched = xsimd::dispatch(dispatch_sum_fn {});
+        auto resolved = xsimd::resolve_dispatch<float(float const*)>(dispatch_sum_fn {});
+        duration_type t_direct = benchmark_dispatch_calls([](float const* data)
+                                                          { return dispatch_sum_fn {}(default_arch {}, data); },
+                                                          f_lhs, res, iter);
+        duration_type t_dispatch = benchmark_dispatch_calls(dispatched, f_lhs, res, iter);
+        duration_type t_dispatch_call = benchmark_dispatch_calls([](float const* data)
+                                                                 { return xsimd::dispatch(dispatch_sum_fn {})(data); },
+                                                                 f_lhs, res, iter);
+        duration_type t_resolved = benchmark_dispatch_calls(resolved, f_lhs, res, iter);
+        duration_type t_pointer = benchmark_dispatch_calls([](float const* data)
+                                                           { return xsimd::dispatch_pointer<dispatch_sum_fn, float(float const*)>()(data); },
+                                                           f_lhs, res, iter);
+
+        out << "============================" << std::endl;
+        out << "dispatch of " << f_lhs.size() << " calls" << std::endl;
+        out << "direct call       : " << t_direct.count() << "ms" << std::endl;
+        out << "dispatch          : " << t_dispatch.count() << "ms" << std::endl;
+        out << "dispatch per call : " << t_dispatch_call.count() << "ms" << std::endl;
+        out << "resolve_dispatch  : " << t_resolved.count() << "ms" << std::endl;
+        out << "dispatch_pointer  : " << t_pointer.count() << "ms" << std::endl;
+        out << "(" << res << ")" << std::endl;
+        out << "============================" << std::endl;
+    }
+
 #define DEFINE_OP_FUNCTOR_2OP(OP, NAME)                       \
     struct NAME##_fn                                          \
     {                                                         \
@@ -67,6 +67,52 @@ namespace xsimd
                                  self, other);
         }
 
+        // bf16_dot
+        template <class A>
+        XSIMD_INLINE batch<float, A> bf16_dot(batch<float, A> const& acc, batch<bfloat16, A> const& x, batch<bfloat16, A> const& y, requires_arch<generic>) noexcept
+        {
+            // a bfloat16 is the upper half of a float, so the odd slot of
+            // each pair is widened by masking and the even one by shifting.
+            // The products of two 8 bit significands are exact in float.
+            using batch_type = batch<uint32_t, A>;
+            auto xw = bitwise_cast<uint32_t>(batch<uint16_t, A>(x.data));
+            auto yw = bitwise_cast<uint32_t>(batch<uint16_t, A>(y.data));
+            auto x_even = bitwise_cast<float>(xw << 16);
+            auto y_even = bitwise_cast<float>(yw << 16);
+            auto x_odd = bitwise_cast<float>(xw & batch_type(0xFFFF0000u));
+            auto y_odd = bitwise_cast<float>(yw & batch_type(0xFFFF0000u));
+            return (acc + x_odd * y_odd) + x_even * y_even;
+        }
+
+        // dot_accumulate
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<int16_t, A> const& x, batch<int16_t, A> const& y, requires_arch<generic>) noexcept
+        {
+            // sign-extend the low and high halves of each 32-bit slot
+            auto xw = bitwise_cast<uint32_t>(x);
+            auto yw = bitwise_cast<uint32_t>(y);
+            auto x_lo = bitwise_cast<int32_t>(xw << 16) >> 16;
+            auto y_lo = bitwise_cast<int32_t>(yw << 16) >> 16;
+            auto x_hi = bitwise_cast<int32_t>(xw) >> 16;
+            auto y_hi = bitwise_cast<int32_t>(yw) >> 16;
+            return acc + x_lo * y_lo + x_hi * y_hi;
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<uint8_t, A> const& x, batch<int8_t, A> const& y, requires_arch<generic>) noexcept
+        {
+            // widen even and odd bytes to 16 bits (zero-extending x,
+            // sign-extending y) and reuse the 16-bit dot product, whose
+            // products are computed on 32 bits and never saturate.
+            auto xw = bitwise_cast<uint16_t>(x);
+            auto yw = bitwise_cast<uint16_t>(y);
+            auto x_even = bitwise_cast<int16_t>(xw & batch<uint16_t, A>(0x00FF));
+            auto x_odd = bitwise_cast<int16_t>(xw >> 8);
+            auto y_even = bitwise_cast<int16_t>(yw << 8) >> 8;
+            auto y_odd = bitwise_cast<int16_t>(yw) >> 8;
+            return dot_accumulate(dot_accumulate(acc, x_even, y_even, A {}), x_odd, y_odd, A {});
+        }
+
         // fma
         template <class A, class T>
         XSIMD_INLINE batch<T, A> fma(batch<T, A> const& x, batch<T, A> const& y, batch<T, A> const& z, requires_arch<generic>) noexcept
@@ -155,6 +201,56 @@ namespace xsimd
             return select(mask, incr(self), self);
         }
 
+        // mmla
+        namespace detail
+        {
+            template <class A, class T_acc, class T_x, class T_y>
+            XSIMD_INLINE batch<T_acc, A> mmla(batch<T_acc, A> const& acc, batch<T_x, A> const& x, batch<T_y, A> const& y) noexcept
+            {
+                // each 128-bit block holds a 2x2 accumulator, a 2x8 left
+                // operand and the transpose of a 8x2 right operand.
+                constexpr std::size_t nb_blocks = batch<T_acc, A>::size / 4;
+                alignas(A::alignment()) T_acc acc_buffer[batch<T_acc, A>::size];
+                alignas(A::alignment()) T_x x_buffer[batch<T_x, A>::size];
+                alignas(A::alignment()) T_y y_buffer[batch<T_y, A>::size];
+                acc.store_aligned(&acc_buffer[0]);
+                x.store_aligned(&x_buffer[0]);
+                y.store_aligned(&y_buffer[0]);
+                for (std::size_t b = 0; b < nb_blocks; ++b)
+                {
+                    for (std::size_t i = 0; i < 2; ++i)
+                    {
+                        for (std::size_t j = 0; j < 2; ++j)
+                        {
+                            T_acc res = acc_buffer[4 * b + 2 * i + j];
+                            for (std::size_t k = 0; k < 8; ++k)
+                                res += static_cast<T_acc>(x_buffer[16 * b + 8 * i + k]) * static_cast<T_acc>(y_buffer[16 * b + 8 * j + k]);
+                            acc_buffer[4 * b + 2 * i + j] = res;
+                        }
+                    }
+                }
+                return batch<T_acc, A>::load_aligned(&acc_buffer[0]);
+            }
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> mmla(batch<int32_t, A> const& acc, batch<int8_t, A> const& x, batch<int8_t, A> const& y, requires_arch<generic>) noexcept
+        {
+            return detail::mmla(acc, x, y);
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<uint32_t, A> mmla(batch<uint32_t, A> const& acc, batch<uint8_t, A> const& x, batch<uint8_t, A> const& y, requires_arch<generic>) noexcept
+        {
+            return detail::mmla(acc, x, y);
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> mmla(batch<int32_t, A> const& acc, batch<uint8_t, A> const& x, batch<int8_t, A> const& y, requires_arch<generic>) noexcept
+        {
+            return detail::mmla(acc, x, y);
+        }
+
         // mul
         template <class A, class T, class /*=typename std::enable_if<std::is_integral<T>::value, void>::type*/>
         XSIMD_INLINE batch<T, A> mul(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) noexcept
@@ -164,6 +260,69 @@ namespace xsimd
                                  self, other);
         }
 
+        // mul_hi
+        template <class A>
+        XSIMD_INLINE batch<uint64_t, A> mul_hi(batch<uint64_t, A> const& self, batch<uint64_t, A> const& other, requires_arch<generic>) noexcept
+        {
+            // schoolbook multiplication on 32 bit limbs, each partial
+            // product fits in 64 bits.
+            const batch<uint64_t, A> mask(0xFFFFFFFFull);
+            auto self_lo = self & mask;
+            auto self_hi = self >> 32;
+            auto other_lo = other & mask;
+            auto other_hi = other >> 32;
+            auto lo_lo = self_lo * other_lo;
+            auto lo_hi = self_lo * other_hi;
+            auto hi_lo = self_hi * other_lo;
+            auto hi_hi = self_hi * other_hi;
+            auto mid = (lo_lo >> 32) + (lo_hi & mask) + (hi_lo & mask);
+            return hi_hi + (lo_hi >> 32) + (hi_lo >> 32) + (mid >> 32);
+        }
+
+        // madd52hi
+        template <class A>
+        XSIMD_INLINE batch<uint64_t, A> madd52hi(batch<uint64_t, A> const& self, batch<uint64_t, A> const& x, batch<uint64_t, A> const& y, requires_arch<generic>) noexcept
+        {
+            const batch<uint64_t, A> mask((1ull << 52) - 1);
+            auto x52 = x & mask;
+            auto y52 = y & mask;
+            // bits 52 to 103 of the 104 bit product
+            return self + ((mul_hi(x52, y52, A {}) << 12) | ((x52 * y52) >> 52));
+        }
+
+        // madd52lo
+        template <class A>
+        XSIMD_INLINE batch<uint64_t, A> madd52lo(batch<uint64_t, A> const& self, batch<uint64_t, A> const& x, batch<uint64_t, A> const& y, requires_arch<generic>) noexcept
+        {
+            const batch<uint64_t, A> mask((1ull << 52) - 1);
+            return self + (((x & mask) * (y & mask)) & mask);
+        }
+
+        // prefix_sum
+        namespace detail
+        {
+            // log2(size) steps of x += x slid by I slots, I = 1, 2, 4...
+            template <std::size_t I, class A, class T>
+            XSIMD_INLINE batch<T, A> prefix_sum_slide(batch<T, A> const& self, std::true_type) noexcept
+            {
+                return self;
+            }
+
+            template <std::size_t I, class A, class T>
+            XSIMD_INLINE batch<T, A> prefix_sum_slide(batch<T, A> const& self, std::false_type) noexcept
+            {
+                using uint_type = as_unsigned_integer_t<T>;
+                auto slid = bitwise_cast<T>(slide_left<I * sizeof(T), A>(bitwise_cast<uint_type>(self), A {}));
+                return prefix_sum_slide<2 * I, A>(self + slid, std::integral_constant<bool, (2 * I >= batch<T, A>::size)>());
+            }
+        }
+
+        template <class A, class T>
+        XSIMD_INLINE batch<T, A> prefix_sum(batch<T, A> const& self, requires_arch<generic>) noexcept
+        {
+            return detail::prefix_sum_slide<1, A>(self, std::integral_constant<bool, (batch<T, A>::size == 1)>());
+        }
+
         // rotl
         template <class A, class T, class STy>
         XSIMD_INLINE batch<T, A> rotl(batch<T, A> const& self, STy other, requires_arch<generic>) noexcept
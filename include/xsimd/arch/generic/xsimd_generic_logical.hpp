@@ -22,6 +22,27 @@ namespace xsimd
 
         using namespace types;
 
+        // conflict
+        template <class A, class T>
+        XSIMD_INLINE batch<T, A> conflict(batch<T, A> const& self, requires_arch<generic>) noexcept
+        {
+            static_assert(std::is_integral<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), "conflict only supports 32 and 64 bit integers");
+            constexpr std::size_t size = batch<T, A>::size;
+            static_assert(size <= 8 * sizeof(T), "one bit per slot");
+            alignas(A::alignment()) T buffer[size];
+            alignas(A::alignment()) T res[size];
+            self.store_aligned(&buffer[0]);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                using unsigned_type = as_unsigned_integer_t<T>;
+                unsigned_type bits = 0;
+                for (std::size_t j = 0; j < i; ++j)
+                    bits |= static_cast<unsigned_type>(buffer[j] == buffer[i]) << j;
+                res[i] = static_cast<T>(bits);
+            }
+            return batch<T, A>::load_aligned(&res[0]);
+        }
+
         // from  mask
         template <class A, class T>
         XSIMD_INLINE batch_bool<T, A> from_mask(batch_bool<T, A> const&, uint64_t mask, requires_arch<generic>) noexcept
@@ -2092,6 +2092,36 @@ namespace xsimd
             }
         }
 
+        namespace detail
+        {
+            template <class A, class T>
+            XSIMD_INLINE std::size_t first_lane(batch_bool<T, A> const& self) noexcept
+            {
+                uint64_t bits = self.mask();
+                std::size_t index = 0;
+                while (bits != 0 && (bits & 1) == 0)
+                {
+                    bits >>= 1;
+                    ++index;
+                }
+                return index;
+            }
+        }
+
+        // reduce_argmax
+        template <class A, class T>
+        XSIMD_INLINE std::size_t reduce_argmax(batch<T, A> const& self, requires_arch<generic>) noexcept
+        {
+            return detail::first_lane(self == batch<T, A>(reduce_max(self)));
+        }
+
+        // reduce_argmin
+        template <class A, class T>
+        XSIMD_INLINE std::size_t reduce_argmin(batch<T, A> const& self, requires_arch<generic>) noexcept
+        {
+            return detail::first_lane(self == batch<T, A>(reduce_min(self)));
+        }
+
         // reduce_max
         template <class A, class T>
         XSIMD_INLINE T reduce_max(batch<T, A> const& self, requires_arch<generic>) noexcept
@@ -13,6 +13,8 @@
 #define XSIMD_GENERIC_MEMORY_HPP
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <complex>
 #include <stdexcept>
 
@@ -61,6 +63,25 @@ namespace xsimd
             return swizzle(z, compress_mask);
         }
 
+        // compress_store
+        template <class A, class T>
+        XSIMD_INLINE std::size_t compress_store(T* mem, batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<generic>) noexcept
+        {
+            constexpr std::size_t size = batch<T, A>::size;
+            alignas(A::alignment()) T buffer[size];
+            self.store_aligned(&buffer[0]);
+            uint64_t bits = mask.mask();
+            // branchless packing of the selected elements in the buffer
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                buffer[count] = buffer[i];
+                count += (bits >> i) & 1u;
+            }
+            std::copy(&buffer[0], &buffer[0] + count, mem);
+            return count;
+        }
+
         // expand
         namespace detail
         {
@@ -86,6 +107,28 @@ namespace xsimd
             return select(mask, z, batch<T, A>(T(0)));
         }
 
+        // expand_load
+        template <class A, class T>
+        XSIMD_INLINE batch<T, A> expand_load(T const* mem, batch_bool<T, A> const& mask, batch<T, A> const& src, requires_arch<generic>) noexcept
+        {
+            constexpr std::size_t size = batch<T, A>::size;
+            alignas(A::alignment()) T buffer[size];
+            src.store_aligned(&buffer[0]);
+            uint64_t bits = mask.mask();
+            T packed[size];
+            std::copy(mem, mem + ::xsimd::detail::popcount(bits), &packed[0]);
+            // branchless spreading of the packed elements in the buffer,
+            // the packed index never exceeds the lane index
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                bool selected = (bits >> i) & 1u;
+                buffer[i] = selected ? packed[count] : buffer[i];
+                count += selected;
+            }
+            return batch<T, A>::load_aligned(&buffer[0]);
+        }
+
         // extract_pair
         template <class A, class T>
         XSIMD_INLINE batch<T, A> extract_pair(batch<T, A> const& self, batch<T, A> const& other, std::size_t i, requires_arch<generic>) noexcept
@@ -169,6 +212,30 @@ namespace xsimd
             return batch_cast<T>(kernel::gather(batch<U, A> {}, src, index, A {}));
         }
 
+        // Gather of the slots selected by a mask, the other ones being taken
+        // from fallback without reading their index.
+        template <typename T, typename A, typename U, typename V>
+        XSIMD_INLINE batch<T, A>
+        gather(batch<T, A> const& fallback, U const* src, batch<V, A> const& index,
+               batch_bool<T, A> const& mask, kernel::requires_arch<generic>) noexcept
+        {
+            static_assert(batch<T, A>::size == batch<V, A>::size,
+                          "Index and destination sizes must match");
+
+            constexpr std::size_t size = batch<T, A>::size;
+            alignas(A::alignment()) T buffer[size];
+            alignas(A::alignment()) V offsets[size];
+            fallback.store_aligned(&buffer[0]);
+            index.store_aligned(&offsets[0]);
+            uint64_t bits = mask.mask();
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if ((bits >> i) & 1u)
+                    buffer[i] = static_cast<T>(src[offsets[i]]);
+            }
+            return batch<T, A>::load_aligned(&buffer[0]);
+        }
+
         // insert
         template <class A, class T, size_t I>
         XSIMD_INLINE batch<T, A> insert(batch<T, A> const& self, T val, index<I>, requires_arch<generic>) noexcept
@@ -234,6 +301,57 @@ namespace xsimd
             return buffer[i];
         }
 
+        // float16 conversions
+        namespace detail
+        {
+            // Vectorized counterparts of float16_bits_to_float and
+            // float_to_float16_bits, operating on binary16 values held in
+            // the low half of 32 bit slots.
+            template <class A>
+            XSIMD_INLINE batch<float, A> float16_to_float(batch<uint32_t, A> const& h) noexcept
+            {
+                using batch_type = batch<uint32_t, A>;
+                const batch_type shifted_exp(0x7C00u << 13);
+                batch_type o = (h & batch_type(0x7FFFu)) << 13;
+                batch_type exp = o & shifted_exp;
+                o = o + batch_type((127u - 15u) << 23);
+                batch_type special = o + batch_type((128u - 16u) << 23);
+                special = select((special & batch_type(0x7FFFFFu)) != batch_type(0u), special | batch_type(0x400000u), special);
+                o = select(exp == shifted_exp, special, o);
+                auto subnormal = bitwise_cast<float>(o + batch_type(1u << 23)) - bitwise_cast<float>(batch_type(113u << 23));
+                o = select(exp == batch_type(0u), bitwise_cast<uint32_t>(subnormal), o);
+                return bitwise_cast<float>(o | ((h & batch_type(0x8000u)) << 16));
+            }
+
+            template <class A>
+            XSIMD_INLINE batch<uint32_t, A> float_to_float16(batch<float, A> const& f) noexcept
+            {
+                using batch_type = batch<uint32_t, A>;
+                batch_type bits = bitwise_cast<uint32_t>(f);
+                batch_type sign = bits & batch_type(0x80000000u);
+                bits = bits ^ sign;
+                batch_type special = select(bits > batch_type(255u << 23), batch_type(0x7E00u), batch_type(0x7C00u));
+                const batch_type denorm_magic(((127u - 15u) + (23u - 10u) + 1u) << 23);
+                batch_type subnormal = bitwise_cast<uint32_t>(bitwise_cast<float>(bits) + bitwise_cast<float>(denorm_magic)) - denorm_magic;
+                batch_type mant_odd = (bits >> 13) & batch_type(1u);
+                batch_type normal = (bits + batch_type((15u << 23) - (127u << 23) + 0xFFFu) + mant_odd) >> 13;
+                batch_type o = select(bits >= batch_type((127u + 16u) << 23), special,
+                                      select(bits < batch_type(113u << 23), subnormal, normal));
+                return o | (sign >> 16);
+            }
+
+            // Vectorized float_to_bfloat16_bits, the rounded bfloat16 is
+            // left in the upper half of each 32 bit slot.
+            template <class A>
+            XSIMD_INLINE batch<uint32_t, A> float_to_bfloat16(batch<float, A> const& f) noexcept
+            {
+                using batch_type = batch<uint32_t, A>;
+                batch_type bits = bitwise_cast<uint32_t>(f);
+                batch_type rounded = bits + batch_type(0x7FFFu) + ((bits >> 16) & batch_type(1u));
+                return select((bits & batch_type(0x7FFFFFFFu)) > batch_type(0x7F800000u), bits | batch_type(0x400000u), rounded);
+            }
+        }
+
         // load_aligned
         namespace detail
         {
@@ -260,6 +378,158 @@ namespace xsimd
             return detail::load_aligned<A>(mem, cvt, A {}, detail::conversion_type<A, T_in, T_out> {});
         }
 
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_aligned(float16 const* mem, convert<float>, requires_arch<generic>) noexcept
+        {
+            alignas(A::alignment()) uint32_t buffer[batch<float, A>::size];
+            for (std::size_t i = 0; i < batch<float, A>::size; ++i)
+                buffer[i] = mem[i].bits();
+            return detail::float16_to_float(batch<uint32_t, A>::load_aligned(&buffer[0]));
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<float16, A> load_aligned(float16 const* mem, convert<float16>, requires_arch<generic>) noexcept
+        {
+            return batch<uint16_t, A>::load_aligned(reinterpret_cast<uint16_t const*>(mem)).data;
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<bfloat16, A> load_aligned(bfloat16 const* mem, convert<bfloat16>, requires_arch<generic>) noexcept
+        {
+            return batch<uint16_t, A>::load_aligned(reinterpret_cast<uint16_t const*>(mem)).data;
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_aligned(bfloat16 const* mem, convert<float>, requires_arch<generic>) noexcept
+        {
+            alignas(A::alignment()) uint32_t buffer[batch<float, A>::size];
+            for (std::size_t i = 0; i < batch<float, A>::size; ++i)
+                buffer[i] = uint32_t(mem[i].bits()) << 16;
+            return bitwise_cast<float>(batch<uint32_t, A>::load_aligned(&buffer[0]));
+        }
+
+        // load_interleaved
+        template <class A, class T, std::size_t N>
+        XSIMD_INLINE void load_interleaved(T const* mem, std::array<batch<T, A>, N>& channels, requires_arch<generic>) noexcept
+        {
+            constexpr std::size_t size = batch<T, A>::size;
+            alignas(A::alignment()) T buffer[N * size];
+            for (std::size_t j = 0; j < size; ++j)
+                for (std::size_t c = 0; c < N; ++c)
+                    buffer[c * size + j] = mem[j * N + c];
+            for (std::size_t c = 0; c < N; ++c)
+                channels[c] = batch<T, A>::load_aligned(&buffer[c * size]);
+        }
+
+        // load_masked
+        template <class A, class T>
+        XSIMD_INLINE batch<T, A> load_masked(T const* mem, batch_bool<T, A> const& mask, requires_arch<generic>) noexcept
+        {
+            constexpr std::size_t size = batch<T, A>::size;
+            alignas(A::alignment()) T buffer[size] = {};
+            uint64_t bits = mask.mask();
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if ((bits >> i) & 1u)
+                    buffer[i] = mem[i];
+            }
+            return batch<T, A>::load_aligned(&buffer[0]);
+        }
+
+        // load_partial
+        template <class A, class T>
+        XSIMD_INLINE batch<T, A> load_partial(T const* mem, std::size_t n, requires_arch<generic>) noexcept
+        {
+            alignas(A::alignment()) T buffer[batch<T, A>::size] = {};
+            std::copy(mem, mem + n, &buffer[0]);
+            return batch<T, A>::load_aligned(&buffer[0]);
+        }
+
+        // load_strided
+        namespace detail
+        {
+            // The Stride batches loaded to gather a compile-time stride cover
+            // the elements read: batch B starts at element B * size, except
+            // for the last one which is moved back to end on the last
+            // element read, and lane l takes element l * Stride from the
+            // last batch holding it.
+            constexpr std::size_t strided_offset(std::size_t stride, std::size_t b, std::size_t size) noexcept
+            {
+                return b + 1 < stride ? b * size : (stride - 1) * (size - 1);
+            }
+
+            constexpr std::size_t strided_batch(std::size_t stride, std::size_t l, std::size_t size) noexcept
+            {
+                return (l * stride) / size < stride - 1 ? (l * stride) / size : stride - 1;
+            }
+
+            template <class T, std::size_t Stride, std::size_t B>
+            struct strided_index
+            {
+                static constexpr T get(std::size_t l, std::size_t size) noexcept
+                {
+                    return strided_batch(Stride, l, size) == B ? T(l * Stride - strided_offset(Stride, B, size)) : T(0);
+                }
+            };
+
+            template <std::size_t Stride, std::size_t B>
+            struct strided_select
+            {
+                static constexpr bool get(std::size_t l, std::size_t size) noexcept
+                {
+                    return strided_batch(Stride, l, size) == B;
+                }
+            };
+
+            template <std::size_t Stride, class A, class T, std::size_t... Bs>
+            XSIMD_INLINE batch<T, A> load_strided(T const* mem, ::xsimd::detail::index_sequence<Bs...>) noexcept
+            {
+                using index_type = as_unsigned_integer_t<T>;
+                constexpr std::size_t size = batch<T, A>::size;
+                batch<T, A> res = swizzle(batch<T, A>::load_unaligned(mem), make_batch_constant<index_type, A, strided_index<index_type, Stride, 0>>());
+                (void)std::initializer_list<bool> { (Bs == 0 || (res = select(make_batch_bool_constant<T, A, strided_select<Stride, Bs>>(), swizzle(batch<T, A>::load_unaligned(mem + strided_offset(Stride, Bs, size)), make_batch_constant<index_type, A, strided_index<index_type, Stride, Bs>>()), res), true))... };
+                return res;
+            }
+
+            template <std::size_t Stride, class A, class T>
+            XSIMD_INLINE batch<T, A> load_strided(T const* mem, std::true_type) noexcept
+            {
+                return load_strided<Stride, A>(mem, ::xsimd::detail::make_index_sequence<Stride>());
+            }
+
+            template <std::size_t Stride, class A, class T>
+            XSIMD_INLINE batch<T, A> load_strided(T const* mem, std::false_type) noexcept
+            {
+                XSIMD_IF_CONSTEXPR(Stride == 1)
+                {
+                    return batch<T, A>::load_unaligned(mem);
+                }
+                else
+                {
+                    return kernel::load_strided<A>(mem, static_cast<std::ptrdiff_t>(Stride), A {});
+                }
+            }
+        }
+
+        template <class A, class T>
+        XSIMD_INLINE batch<T, A> load_strided(T const* mem, std::ptrdiff_t stride, requires_arch<generic>) noexcept
+        {
+            constexpr std::size_t size = batch<T, A>::size;
+            alignas(A::alignment()) T buffer[size];
+            for (std::size_t i = 0; i < size; ++i)
+                buffer[i] = mem[static_cast<std::ptrdiff_t>(i) * stride];
+            return batch<T, A>::load_aligned(&buffer[0]);
+        }
+
+        // small compile-time strides of 32 and 64 bit elements are served
+        // by whole loads and constant swizzles, larger ones read at most one
+        // element per batch
+        template <class A, std::size_t Stride, class T>
+        XSIMD_INLINE batch<T, A> load_strided(T const* mem, requires_arch<generic>) noexcept
+        {
+            return detail::load_strided<Stride, A>(mem, std::integral_constant<bool, (Stride > 1 && Stride <= batch<T, A>::size && std::is_arithmetic<T>::value && sizeof(T) >= 4)>());
+        }
+
         // load_unaligned
         namespace detail
         {
@@ -284,6 +554,116 @@ namespace xsimd
             return detail::load_unaligned<A>(mem, cvt, generic {}, detail::conversion_type<A, T_in, T_out> {});
         }
 
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_unaligned(float16 const* mem, convert<float> cvt, requires_arch<generic>) noexcept
+        {
+            return load_aligned<A>(mem, cvt, generic {});
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<float16, A> load_unaligned(float16 const* mem, convert<float16>, requires_arch<generic>) noexcept
+        {
+            return batch<uint16_t, A>::load_unaligned(reinterpret_cast<uint16_t const*>(mem)).data;
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<bfloat16, A> load_unaligned(bfloat16 const* mem, convert<bfloat16>, requires_arch<generic>) noexcept
+        {
+            return batch<uint16_t, A>::load_unaligned(reinterpret_cast<uint16_t const*>(mem)).data;
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_unaligned(bfloat16 const* mem, convert<float> cvt, requires_arch<generic>) noexcept
+        {
+            return load_aligned<A>(mem, cvt, generic {});
+        }
+
+        // merge
+        namespace detail
+        {
+            // Bitonic sorting network on the lanes of a batch: lanes i and
+            // i ^ J are compared, and lane i keeps the minimum when it is the
+            // lower lane of an ascending block of K lanes, or the upper lane
+            // of a descending one.
+            template <std::size_t J>
+            struct bitonic_partner_index
+            {
+                static constexpr std::size_t get(std::size_t i, std::size_t) noexcept { return i ^ J; }
+            };
+
+            template <std::size_t K, std::size_t J>
+            struct bitonic_min_lane
+            {
+                static constexpr bool get(std::size_t i, std::size_t) noexcept { return ((i & J) == 0) == ((i & K) == 0); }
+            };
+
+            struct reverse_index
+            {
+                static constexpr std::size_t get(std::size_t i, std::size_t n) noexcept { return n - 1 - i; }
+            };
+
+            template <std::size_t K, std::size_t J, class A, class T>
+            XSIMD_INLINE batch<T, A> bitonic_exchange(batch<T, A> const& self) noexcept
+            {
+                using index_type = as_unsigned_integer_t<T>;
+                batch<T, A> partner = swizzle(self, make_batch_constant<index_type, A, bitonic_partner_index<J>>());
+                return select(make_batch_bool_constant<T, A, bitonic_min_lane<K, J>>(), min(self, partner), max(self, partner));
+            }
+
+            // sorts a bitonic sequence of K lanes, J = K / 2 ... 1
+            template <std::size_t K, std::size_t J, class A, class T>
+            XSIMD_INLINE batch<T, A> bitonic_merge(batch<T, A> const& self, std::true_type) noexcept
+            {
+                return self;
+            }
+
+            template <std::size_t K, std::size_t J, class A, class T>
+            XSIMD_INLINE batch<T, A> bitonic_merge(batch<T, A> const& self, std::false_type) noexcept
+            {
+                return bitonic_merge<K, J / 2>(bitonic_exchange<K, J>(self), std::integral_constant<bool, (J / 2 == 0)>());
+            }
+
+            // sorts blocks of K lanes in alternating directions, K = 2 ... size
+            template <std::size_t K, class A, class T>
+            XSIMD_INLINE batch<T, A> bitonic_sort(batch<T, A> const& self, std::true_type) noexcept
+            {
+                return self;
+            }
+
+            template <std::size_t K, class A, class T>
+            XSIMD_INLINE batch<T, A> bitonic_sort(batch<T, A> const& self, std::false_type) noexcept
+            {
+                return bitonic_sort<2 * K>(bitonic_merge<K, K / 2>(self, std::false_type()),
+                                           std::integral_constant<bool, (2 * K > batch<T, A>::size)>());
+            }
+        }
+
+        template <class A, class T>
+        XSIMD_INLINE void merge(batch<T, A>& self, batch<T, A>& other, requires_arch<generic>) noexcept
+        {
+            // the minimum of self and of other reversed is a bitonic sequence
+            // holding the smallest half of the elements, the maximum holds the
+            // greatest half
+            using index_type = as_unsigned_integer_t<T>;
+            constexpr std::size_t size = batch<T, A>::size;
+            batch<T, A> reversed = swizzle(other, make_batch_constant<index_type, A, detail::reverse_index>());
+            batch<T, A> low = min(self, reversed);
+            batch<T, A> high = max(self, reversed);
+            self = detail::bitonic_merge<2 * size, size / 2>(low, std::integral_constant<bool, (size == 1)>());
+            other = detail::bitonic_merge<2 * size, size / 2>(high, std::integral_constant<bool, (size == 1)>());
+        }
+
+        // prefetch
+        template <class A, int Locality>
+        XSIMD_INLINE void prefetch(void const* ptr, requires_arch<generic>) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(ptr, 0, Locality);
+#else
+            (void)ptr;
+#endif
+        }
+
         // rotate_left
         template <size_t N, class A, class T>
         XSIMD_INLINE batch<T, A> rotate_left(batch<T, A> const& self, requires_arch<generic>) noexcept
@@ -386,6 +766,22 @@ namespace xsimd
             kernel::scatter<A>(tmp, dst, index, A {});
         }
 
+        // scatter_add
+        template <class A, class T, class V>
+        XSIMD_INLINE void scatter_add(T* dst, batch<V, A> const& index, batch<T, A> const& values, requires_arch<generic>) noexcept
+        {
+            static_assert(batch<T, A>::size == batch<V, A>::size,
+                          "Source and index sizes must match");
+            // Sequential read-modify-write, so that colliding indices
+            // accumulate instead of overwriting each other.
+            alignas(A::alignment()) V index_buffer[batch<V, A>::size];
+            alignas(A::alignment()) T values_buffer[batch<T, A>::size];
+            index.store_aligned(&index_buffer[0]);
+            values.store_aligned(&values_buffer[0]);
+            for (std::size_t i = 0; i < batch<T, A>::size; ++i)
+                dst[index_buffer[i]] += values_buffer[i];
+        }
+
         // shuffle
         namespace detail
         {
@@ -511,6 +907,13 @@ namespace xsimd
 #endif
         }
 
+        // sort
+        template <class A, class T>
+        XSIMD_INLINE batch<T, A> sort(batch<T, A> const& self, requires_arch<generic>) noexcept
+        {
+            return detail::bitonic_sort<2>(self, std::integral_constant<bool, (batch<T, A>::size == 1)>());
+        }
+
         // store
         template <class T, class A>
         XSIMD_INLINE void store(batch_bool<T, A> const& self, bool* mem, requires_arch<generic>) noexcept
@@ -523,6 +926,83 @@ namespace xsimd
                 mem[i] = bool(buffer[i]);
         }
 
+        // store_interleaved
+        template <class A, class T, std::size_t N>
+        XSIMD_INLINE void store_interleaved(T* mem, std::array<batch<T, A>, N> const& channels, requires_arch<generic>) noexcept
+        {
+            constexpr std::size_t size = batch<T, A>::size;
+            alignas(A::alignment()) T buffer[N * size];
+            for (std::size_t c = 0; c < N; ++c)
+                channels[c].store_aligned(&buffer[c * size]);
+            for (std::size_t j = 0; j < size; ++j)
+                for (std::size_t c = 0; c < N; ++c)
+                    mem[j * N + c] = buffer[c * size + j];
+        }
+
+        // store_masked
+        template <class A, class T>
+        XSIMD_INLINE void store_masked(T* mem, batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<generic>) noexcept
+        {
+            constexpr std::size_t size = batch<T, A>::size;
+            alignas(A::alignment()) T buffer[size];
+            self.store_aligned(&buffer[0]);
+            uint64_t bits = mask.mask();
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if ((bits >> i) & 1u)
+                    mem[i] = buffer[i];
+            }
+        }
+
+        // store_stream
+        template <class A, class T>
+        XSIMD_INLINE void store_stream(T* mem, batch<T, A> const& self, requires_arch<generic>) noexcept
+        {
+            store_aligned<A>(mem, self, A {});
+        }
+
+        // store_strided
+        template <class A, class T>
+        XSIMD_INLINE void store_strided(T* mem, batch<T, A> const& self, std::ptrdiff_t stride, requires_arch<generic>) noexcept
+        {
+            constexpr std::size_t size = batch<T, A>::size;
+            alignas(A::alignment()) T buffer[size];
+            self.store_aligned(&buffer[0]);
+            for (std::size_t i = 0; i < size; ++i)
+                mem[static_cast<std::ptrdiff_t>(i) * stride] = buffer[i];
+        }
+
+        // the elements between two strided ones may not be written, which
+        // rules out shuffles and whole stores
+        template <class A, std::size_t Stride, class T>
+        XSIMD_INLINE void store_strided(T* mem, batch<T, A> const& self, requires_arch<generic>) noexcept
+        {
+            XSIMD_IF_CONSTEXPR(Stride == 1)
+            {
+                self.store_unaligned(mem);
+            }
+            else
+            {
+                kernel::store_strided<A>(mem, self, static_cast<std::ptrdiff_t>(Stride), A {});
+            }
+        }
+
+        // stream_fence
+        template <class A>
+        XSIMD_INLINE void stream_fence(requires_arch<generic>) noexcept
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        // store_partial
+        template <class A, class T>
+        XSIMD_INLINE void store_partial(T* mem, batch<T, A> const& self, std::size_t n, requires_arch<generic>) noexcept
+        {
+            alignas(A::alignment()) T buffer[batch<T, A>::size];
+            self.store_aligned(&buffer[0]);
+            std::copy(&buffer[0], &buffer[0] + n, mem);
+        }
+
         // store_aligned
         template <class A, class T_in, class T_out>
         XSIMD_INLINE void store_aligned(T_out* mem, batch<T_in, A> const& self, requires_arch<generic>) noexcept
@@ -533,6 +1013,36 @@ namespace xsimd
             std::copy(std::begin(buffer), std::end(buffer), mem);
         }
 
+        template <class A>
+        XSIMD_INLINE void store_aligned(float16* mem, batch<float, A> const& self, requires_arch<generic>) noexcept
+        {
+            alignas(A::alignment()) uint32_t buffer[batch<float, A>::size];
+            detail::float_to_float16(self).store_aligned(&buffer[0]);
+            for (std::size_t i = 0; i < batch<float, A>::size; ++i)
+                mem[i] = float16::from_bits(static_cast<uint16_t>(buffer[i]));
+        }
+
+        template <class A>
+        XSIMD_INLINE void store_aligned(float16* mem, batch<float16, A> const& self, requires_arch<generic>) noexcept
+        {
+            batch<uint16_t, A>(self.data).store_aligned(reinterpret_cast<uint16_t*>(mem));
+        }
+
+        template <class A>
+        XSIMD_INLINE void store_aligned(bfloat16* mem, batch<bfloat16, A> const& self, requires_arch<generic>) noexcept
+        {
+            batch<uint16_t, A>(self.data).store_aligned(reinterpret_cast<uint16_t*>(mem));
+        }
+
+        template <class A>
+        XSIMD_INLINE void store_aligned(bfloat16* mem, batch<float, A> const& self, requires_arch<generic>) noexcept
+        {
+            alignas(A::alignment()) uint32_t buffer[batch<float, A>::size];
+            detail::float_to_bfloat16(self).store_aligned(&buffer[0]);
+            for (std::size_t i = 0; i < batch<float, A>::size; ++i)
+                mem[i] = bfloat16::from_bits(static_cast<uint16_t>(buffer[i] >> 16));
+        }
+
         // store_unaligned
         template <class A, class T_in, class T_out>
         XSIMD_INLINE void store_unaligned(T_out* mem, batch<T_in, A> const& self, requires_arch<generic>) noexcept
@@ -541,6 +1051,30 @@ namespace xsimd
             return store_aligned<A>(mem, self, generic {});
         }
 
+        template <class A>
+        XSIMD_INLINE void store_unaligned(float16* mem, batch<float, A> const& self, requires_arch<generic>) noexcept
+        {
+            return store_aligned<A>(mem, self, generic {});
+        }
+
+        template <class A>
+        XSIMD_INLINE void store_unaligned(float16* mem, batch<float16, A> const& self, requires_arch<generic>) noexcept
+        {
+            batch<uint16_t, A>(self.data).store_unaligned(reinterpret_cast<uint16_t*>(mem));
+        }
+
+        template <class A>
+        XSIMD_INLINE void store_unaligned(bfloat16* mem, batch<bfloat16, A> const& self, requires_arch<generic>) noexcept
+        {
+            batch<uint16_t, A>(self.data).store_unaligned(reinterpret_cast<uint16_t*>(mem));
+        }
+
+        template <class A>
+        XSIMD_INLINE void store_unaligned(bfloat16* mem, batch<float, A> const& self, requires_arch<generic>) noexcept
+        {
+            return store_aligned<A>(mem, self, generic {});
+        }
+
         // swizzle
         template <class A, class T, class ITy, ITy... Vs>
         XSIMD_INLINE batch<std::complex<T>, A> swizzle(batch<std::complex<T>, A> const& self, batch_constant<ITy, A, Vs...> mask, requires_arch<generic>) noexcept
@@ -570,6 +1104,79 @@ namespace xsimd
             return { swizzle(self.real(), mask), swizzle(self.imag(), mask) };
         }
 
+        // to_float
+        namespace detail
+        {
+            // float16 and bfloat16 batches hold twice as many slots as a
+            // float batch, they are converted through the converting loads
+            // and stores of their storage type
+            template <class A, class T>
+            XSIMD_INLINE std::array<batch<float, A>, 2> storage_to_float(batch<T, A> const& self) noexcept
+            {
+                constexpr size_t size = batch<float, A>::size;
+                static_assert(batch<T, A>::size == 2 * size, "a 16 bit float batch holds two float batches");
+                alignas(A::alignment()) T buffer[2 * size];
+                self.store_aligned(&buffer[0]);
+                return { load_aligned<A>(&buffer[0], convert<float> {}, A {}),
+                         load_unaligned<A>(&buffer[size], convert<float> {}, A {}) };
+            }
+
+            template <class A, class T>
+            XSIMD_INLINE batch<T, A> float_to_storage(batch<float, A> const& lo, batch<float, A> const& hi) noexcept
+            {
+                constexpr size_t size = batch<float, A>::size;
+                static_assert(batch<T, A>::size == 2 * size, "a 16 bit float batch holds two float batches");
+                alignas(A::alignment()) T buffer[2 * size];
+                store_aligned<A>(&buffer[0], lo, A {});
+                store_unaligned<A>(&buffer[size], hi, A {});
+                return batch<T, A>::load_aligned(&buffer[0]);
+            }
+        }
+
+        template <class A>
+        XSIMD_INLINE std::array<batch<float, A>, 2> to_float(batch<float16, A> const& self, requires_arch<generic>) noexcept
+        {
+            return detail::storage_to_float<A>(self);
+        }
+
+        template <class A>
+        XSIMD_INLINE std::array<batch<float, A>, 2> to_float(batch<bfloat16, A> const& self, requires_arch<generic>) noexcept
+        {
+            return detail::storage_to_float<A>(self);
+        }
+
+        // to_bfloat16
+        template <class A>
+        XSIMD_INLINE batch<bfloat16, A> to_bfloat16(batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<generic>) noexcept
+        {
+            return detail::float_to_storage<A, bfloat16>(lo, hi);
+        }
+
+        // to_float16
+        template <class A>
+        XSIMD_INLINE batch<float16, A> to_float16(batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<generic>) noexcept
+        {
+            return detail::float_to_storage<A, float16>(lo, hi);
+        }
+
+        // lookup
+        template <class A, class T, class ITy>
+        XSIMD_INLINE batch<T, A> lookup(batch<T, A> const& table_lo, batch<T, A> const& table_hi, batch<ITy, A> const& idx, requires_arch<generic>) noexcept
+        {
+            constexpr size_t size = batch<T, A>::size;
+            alignas(A::alignment()) T table_buffer[2 * size];
+            table_lo.store_aligned(&table_buffer[0]);
+            table_hi.store_aligned(&table_buffer[size]);
+
+            alignas(A::alignment()) ITy idx_buffer[size];
+            idx.store_aligned(&idx_buffer[0]);
+
+            alignas(A::alignment()) T out_buffer[size];
+            for (size_t i = 0; i < size; ++i)
+                out_buffer[i] = table_buffer[idx_buffer[i] & (2 * size - 1)];
+            return batch<T, A>::load_aligned(out_buffer);
+        }
+
         // load_complex_aligned
         namespace detail
         {
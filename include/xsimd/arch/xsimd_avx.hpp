@@ -12,6 +12,7 @@
 #ifndef XSIMD_AVX_HPP
 #define XSIMD_AVX_HPP
 
+#include <array>
 #include <complex>
 #include <limits>
 #include <type_traits>
@@ -843,6 +844,58 @@ namespace xsimd
             }
         }
 
+        // load_interleaved
+        template <class A, class T, std::size_t N, class = typename std::enable_if<std::is_arithmetic<T>::value, void>::type>
+        XSIMD_INLINE void load_interleaved(T const* mem, std::array<batch<T, A>, N>& channels, requires_arch<avx>) noexcept
+        {
+            // deinterleave each half with the SSE kernels
+            using half_batch = batch<T, sse4_2>;
+            std::array<half_batch, N> low, high;
+            load_interleaved<sse4_2>(mem, low, sse4_2 {});
+            load_interleaved<sse4_2>(mem + N * half_batch::size, high, sse4_2 {});
+            for (std::size_t c = 0; c < N; ++c)
+                channels[c] = detail::merge_sse(low[c], high[c]);
+        }
+
+        // load_masked
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_masked(float const* mem, batch_bool<float, A> const& mask, requires_arch<avx>) noexcept
+        {
+            return _mm256_maskload_ps(mem, _mm256_castps_si256(mask));
+        }
+        template <class A>
+        XSIMD_INLINE batch<double, A> load_masked(double const* mem, batch_bool<double, A> const& mask, requires_arch<avx>) noexcept
+        {
+            return _mm256_maskload_pd(mem, _mm256_castpd_si256(mask));
+        }
+        template <class A, class T, detail::enable_sized_integral_t<T, 4> = 0>
+        XSIMD_INLINE batch<T, A> load_masked(T const* mem, batch_bool<T, A> const& mask, requires_arch<avx>) noexcept
+        {
+            return _mm256_castps_si256(_mm256_maskload_ps(reinterpret_cast<float const*>(mem), mask));
+        }
+        template <class A, class T, detail::enable_sized_integral_t<T, 8> = 0>
+        XSIMD_INLINE batch<T, A> load_masked(T const* mem, batch_bool<T, A> const& mask, requires_arch<avx>) noexcept
+        {
+            return _mm256_castpd_si256(_mm256_maskload_pd(reinterpret_cast<double const*>(mem), mask));
+        }
+
+        // load_partial
+        namespace detail
+        {
+            // mask selecting the n first 32 bit words of a register
+            XSIMD_INLINE __m256i avx_partial_mask(std::size_t n) noexcept
+            {
+                return _mm256_castps_si256(_mm256_cmp_ps(_mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f),
+                                                         _mm256_set1_ps(static_cast<float>(n)), _CMP_LT_OQ));
+            }
+        }
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE batch<T, A> load_partial(T const* mem, std::size_t n, requires_arch<avx>) noexcept
+        {
+            __m256 res = _mm256_maskload_ps(reinterpret_cast<float const*>(mem), detail::avx_partial_mask(n * sizeof(T) / 4));
+            return bitwise_cast<T>(batch<float, A>(res));
+        }
+
         // load_unaligned
         template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
         XSIMD_INLINE batch<T, A> load_unaligned(T const* mem, convert<T>, requires_arch<avx>) noexcept
@@ -859,6 +912,18 @@ namespace xsimd
         {
             return _mm256_loadu_pd(mem);
         }
+#if XSIMD_WITH_F16C
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_unaligned(float16 const* mem, convert<float>, requires_arch<avx>) noexcept
+        {
+            return _mm256_cvtph_ps(_mm_loadu_si128((__m128i const*)mem));
+        }
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_aligned(float16 const* mem, convert<float>, requires_arch<avx>) noexcept
+        {
+            return load_unaligned<A>(mem, convert<float> {}, avx {});
+        }
+#endif
 
         // lt
         template <class A>
@@ -1032,6 +1097,13 @@ namespace xsimd
             return _mm256_castps_si256(_mm256_xor_ps(_mm256_castsi256_ps(self.data), _mm256_castsi256_ps(other.data)));
         }
 
+        // prefetch
+        template <class A, int Locality>
+        XSIMD_INLINE void prefetch(void const* ptr, requires_arch<avx>) noexcept
+        {
+            prefetch<A, Locality>(ptr, sse2 {});
+        }
+
         // reciprocal
         template <class A>
         XSIMD_INLINE batch<float, A> reciprocal(batch<float, A> const& self,
@@ -1397,6 +1469,76 @@ namespace xsimd
             return _mm256_store_pd(mem, self);
         }
 
+        // store_interleaved
+        template <class A, class T, std::size_t N, class = typename std::enable_if<std::is_arithmetic<T>::value, void>::type>
+        XSIMD_INLINE void store_interleaved(T* mem, std::array<batch<T, A>, N> const& channels, requires_arch<avx>) noexcept
+        {
+            using half_batch = batch<T, sse4_2>;
+            std::array<half_batch, N> low, high;
+            for (std::size_t c = 0; c < N; ++c)
+            {
+                typename half_batch::register_type l, h;
+                detail::split_avx(channels[c], l, h);
+                low[c] = l;
+                high[c] = h;
+            }
+            store_interleaved<sse4_2>(mem, low, sse4_2 {});
+            store_interleaved<sse4_2>(mem + N * half_batch::size, high, sse4_2 {});
+        }
+
+        // store_masked
+        template <class A>
+        XSIMD_INLINE void store_masked(float* mem, batch<float, A> const& self, batch_bool<float, A> const& mask, requires_arch<avx>) noexcept
+        {
+            _mm256_maskstore_ps(mem, _mm256_castps_si256(mask), self);
+        }
+        template <class A>
+        XSIMD_INLINE void store_masked(double* mem, batch<double, A> const& self, batch_bool<double, A> const& mask, requires_arch<avx>) noexcept
+        {
+            _mm256_maskstore_pd(mem, _mm256_castpd_si256(mask), self);
+        }
+        template <class A, class T, detail::enable_sized_integral_t<T, 4> = 0>
+        XSIMD_INLINE void store_masked(T* mem, batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<avx>) noexcept
+        {
+            _mm256_maskstore_ps(reinterpret_cast<float*>(mem), mask, _mm256_castsi256_ps(self));
+        }
+        template <class A, class T, detail::enable_sized_integral_t<T, 8> = 0>
+        XSIMD_INLINE void store_masked(T* mem, batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<avx>) noexcept
+        {
+            _mm256_maskstore_pd(reinterpret_cast<double*>(mem), mask, _mm256_castsi256_pd(self));
+        }
+
+        // store_partial
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE void store_partial(T* mem, batch<T, A> const& self, std::size_t n, requires_arch<avx>) noexcept
+        {
+            _mm256_maskstore_ps(reinterpret_cast<float*>(mem), detail::avx_partial_mask(n * sizeof(T) / 4), bitwise_cast<float>(self));
+        }
+
+        // store_stream
+        template <class A>
+        XSIMD_INLINE void store_stream(float* mem, batch<float, A> const& self, requires_arch<avx>) noexcept
+        {
+            _mm256_stream_ps(mem, self);
+        }
+        template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
+        XSIMD_INLINE void store_stream(T* mem, batch<T, A> const& self, requires_arch<avx>) noexcept
+        {
+            _mm256_stream_si256((__m256i*)mem, self);
+        }
+        template <class A>
+        XSIMD_INLINE void store_stream(double* mem, batch<double, A> const& self, requires_arch<avx>) noexcept
+        {
+            _mm256_stream_pd(mem, self);
+        }
+
+        // stream_fence
+        template <class A>
+        XSIMD_INLINE void stream_fence(requires_arch<avx>) noexcept
+        {
+            _mm_sfence();
+        }
+
         // store_unaligned
         template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
         XSIMD_INLINE void store_unaligned(T* mem, batch<T, A> const& self, requires_arch<avx>) noexcept
@@ -1418,6 +1560,28 @@ namespace xsimd
         {
             return _mm256_storeu_pd(mem, self);
         }
+#if XSIMD_WITH_F16C
+        template <class A>
+        XSIMD_INLINE void store_unaligned(float16* mem, batch<float, A> const& self, requires_arch<avx>) noexcept
+        {
+            _mm_storeu_si128((__m128i*)mem, _mm256_cvtps_ph(self, _MM_FROUND_TO_NEAREST_INT));
+        }
+        template <class A>
+        XSIMD_INLINE void store_aligned(float16* mem, batch<float, A> const& self, requires_arch<avx>) noexcept
+        {
+            store_unaligned<A>(mem, self, avx {});
+        }
+        template <class A>
+        XSIMD_INLINE std::array<batch<float, A>, 2> to_float(batch<float16, A> const& self, requires_arch<avx>) noexcept
+        {
+            return { _mm256_cvtph_ps(_mm256_castsi256_si128(self)), _mm256_cvtph_ps(_mm256_extractf128_si256(self, 1)) };
+        }
+        template <class A>
+        XSIMD_INLINE batch<float16, A> to_float16(batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<avx>) noexcept
+        {
+            return _mm256_insertf128_si256(_mm256_castsi128_si256(_mm256_cvtps_ph(lo, _MM_FROUND_TO_NEAREST_INT)), _mm256_cvtps_ph(hi, _MM_FROUND_TO_NEAREST_INT), 1);
+        }
+#endif
 
         // sub
         template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
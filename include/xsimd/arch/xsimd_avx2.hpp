@@ -12,7 +12,10 @@
 #ifndef XSIMD_AVX2_HPP
 #define XSIMD_AVX2_HPP
 
+#include <array>
 #include <complex>
+#include <initializer_list>
+#include <limits>
 #include <type_traits>
 
 #include "../types/xsimd_avx2_register.hpp"
@@ -313,6 +316,138 @@ namespace xsimd
             return _mm256_blend_pd(tmp0, tmp1, 10);
         }
 
+        // compress
+        namespace detail
+        {
+            // Entry m of the table packs, one nibble per lane, the indexes of
+            // the lanes selected by the bits of m, followed by the index of
+            // the first unselected lane for the remaining lanes.
+            constexpr uint32_t compress_selected(uint32_t bits, uint32_t lane, uint32_t pos) noexcept
+            {
+                return bits == 0 ? 0u
+                                 : ((bits & 1u) ? ((lane << (4 * pos)) | compress_selected(bits >> 1, lane + 1, pos + 1))
+                                                : compress_selected(bits >> 1, lane + 1, pos));
+            }
+
+            constexpr uint32_t compress_count(uint32_t bits) noexcept
+            {
+                return bits == 0 ? 0u : (bits & 1u) + compress_count(bits >> 1);
+            }
+
+            constexpr uint32_t compress_first_unselected(uint32_t bits, uint32_t lane) noexcept
+            {
+                return (bits & 1u) ? compress_first_unselected(bits >> 1, lane + 1) : lane;
+            }
+
+            constexpr uint32_t compress_fill(uint32_t lane, uint32_t pos) noexcept
+            {
+                return pos >= 8 ? 0u : ((lane << (4 * pos)) | compress_fill(lane, pos + 1));
+            }
+
+            template <class Is>
+            struct compress_lut;
+
+            template <std::size_t... Is>
+            struct compress_lut<::xsimd::detail::index_sequence<Is...>>
+            {
+                static constexpr uint32_t value[sizeof...(Is)] = {
+                    (compress_selected(Is, 0, 0) | compress_fill(compress_first_unselected(Is, 0), compress_count(Is)))...
+                };
+            };
+
+            template <std::size_t... Is>
+            constexpr uint32_t compress_lut<::xsimd::detail::index_sequence<Is...>>::value[sizeof...(Is)];
+
+            using compress_table = compress_lut<::xsimd::detail::make_index_sequence<256>>;
+
+            // permutation of the 32 bit lanes that packs the lanes selected
+            // by bits, 64 bit lanes are permuted as pairs of 32 bit lanes
+            XSIMD_INLINE __m256i compress_permutation_epi32(uint64_t bits) noexcept
+            {
+                __m256i packed = _mm256_set1_epi32(static_cast<int>(compress_table::value[bits]));
+                __m256i index = _mm256_srlv_epi32(packed, _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+                return _mm256_and_si256(index, _mm256_set1_epi32(0xF));
+            }
+
+            XSIMD_INLINE __m256i compress_permutation_epi64(uint64_t bits) noexcept
+            {
+                __m256i packed = _mm256_set1_epi32(static_cast<int>(compress_table::value[bits]));
+                __m256i index = _mm256_and_si256(_mm256_srlv_epi32(packed, _mm256_setr_epi32(0, 0, 4, 4, 8, 8, 12, 12)), _mm256_set1_epi32(0xF));
+                return _mm256_add_epi32(_mm256_add_epi32(index, index), _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+            }
+
+            template <class A, class T>
+            XSIMD_INLINE batch<T, A> compress_permute(batch<T, A> const& self, uint64_t bits) noexcept
+            {
+                __m256i permutation = sizeof(T) == 4 ? compress_permutation_epi32(bits) : compress_permutation_epi64(bits);
+                return bitwise_cast<T>(batch<float, A>(_mm256_permutevar8x32_ps(bitwise_cast<float>(self), permutation)));
+            }
+        }
+
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE batch<T, A> compress(batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<avx2>) noexcept
+        {
+            // the remaining lanes are filled from an unselected lane, zeroed
+            return detail::compress_permute(select(mask, self, batch<T, A>(T(0))), mask.mask());
+        }
+
+        // compress_store
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE std::size_t compress_store(T* mem, batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<avx2>) noexcept
+        {
+            uint64_t bits = mask.mask();
+            std::size_t count = ::xsimd::detail::popcount(bits);
+            store_partial(mem, detail::compress_permute(self, bits), count, avx {});
+            return count;
+        }
+
+        // expand_load
+        namespace detail
+        {
+            // Entry m of the table packs, one nibble per lane, the number of
+            // lanes selected by the bits of m below each lane, that is the
+            // position of its element in memory.
+            constexpr uint32_t expand_position(uint32_t bits, uint32_t lane, uint32_t count) noexcept
+            {
+                return lane >= 8 ? 0u : ((count << (4 * lane)) | expand_position(bits >> 1, lane + 1, count + (bits & 1u)));
+            }
+
+            template <class Is>
+            struct expand_lut;
+
+            template <std::size_t... Is>
+            struct expand_lut<::xsimd::detail::index_sequence<Is...>>
+            {
+                static constexpr uint32_t value[sizeof...(Is)] = { expand_position(Is, 0, 0)... };
+            };
+
+            template <std::size_t... Is>
+            constexpr uint32_t expand_lut<::xsimd::detail::index_sequence<Is...>>::value[sizeof...(Is)];
+
+            using expand_table = expand_lut<::xsimd::detail::make_index_sequence<256>>;
+        }
+
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE batch<T, A> expand_load(T const* mem, batch_bool<T, A> const& mask, batch<T, A> const& src, requires_arch<avx2>) noexcept
+        {
+            uint64_t bits = mask.mask();
+            // only the selected elements are read from memory
+            batch<T, A> packed = load_partial<A>(mem, ::xsimd::detail::popcount(bits), avx {});
+            __m256i packed_index = _mm256_set1_epi32(static_cast<int>(detail::expand_table::value[bits]));
+            __m256i permutation;
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 4)
+            {
+                permutation = _mm256_and_si256(_mm256_srlv_epi32(packed_index, _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28)), _mm256_set1_epi32(0xF));
+            }
+            else
+            {
+                __m256i index = _mm256_and_si256(_mm256_srlv_epi32(packed_index, _mm256_setr_epi32(0, 0, 4, 4, 8, 8, 12, 12)), _mm256_set1_epi32(0xF));
+                permutation = _mm256_add_epi32(_mm256_add_epi32(index, index), _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+            }
+            batch<T, A> spread = bitwise_cast<T>(batch<float, A>(_mm256_permutevar8x32_ps(bitwise_cast<float>(packed), permutation)));
+            return select(mask, spread, src);
+        }
+
         // fast_cast
         namespace detail
         {
@@ -347,6 +482,13 @@ namespace xsimd
             }
         }
 
+        // dot_accumulate
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<int16_t, A> const& x, batch<int16_t, A> const& y, requires_arch<avx2>) noexcept
+        {
+            return _mm256_add_epi32(acc, _mm256_madd_epi16(x, y));
+        }
+
         // eq
         template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
         XSIMD_INLINE batch_bool<T, A> eq(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx2>) noexcept
@@ -409,6 +551,35 @@ namespace xsimd
             return _mm256_i64gather_pd(src, index, sizeof(double));
         }
 
+        // gather: masked
+        template <class T, class A, class U, detail::enable_sized_integral_t<T, 4> = 0, detail::enable_sized_integral_t<U, 4> = 0>
+        XSIMD_INLINE batch<T, A> gather(batch<T, A> const& fallback, T const* src, batch<U, A> const& index,
+                                        batch_bool<T, A> const& mask, kernel::requires_arch<avx2>) noexcept
+        {
+            return _mm256_mask_i32gather_epi32(fallback, reinterpret_cast<const int*>(src), index, mask, sizeof(T));
+        }
+
+        template <class T, class A, class U, detail::enable_sized_integral_t<T, 8> = 0, detail::enable_sized_integral_t<U, 8> = 0>
+        XSIMD_INLINE batch<T, A> gather(batch<T, A> const& fallback, T const* src, batch<U, A> const& index,
+                                        batch_bool<T, A> const& mask, kernel::requires_arch<avx2>) noexcept
+        {
+            return _mm256_mask_i64gather_epi64(fallback, reinterpret_cast<const long long int*>(src), index, mask, sizeof(T));
+        }
+
+        template <class A, class U, detail::enable_sized_integral_t<U, 4> = 0>
+        XSIMD_INLINE batch<float, A> gather(batch<float, A> const& fallback, float const* src, batch<U, A> const& index,
+                                            batch_bool<float, A> const& mask, kernel::requires_arch<avx2>) noexcept
+        {
+            return _mm256_mask_i32gather_ps(fallback, src, index, mask, sizeof(float));
+        }
+
+        template <class A, class U, detail::enable_sized_integral_t<U, 8> = 0>
+        XSIMD_INLINE batch<double, A> gather(batch<double, A> const& fallback, double const* src, batch<U, A> const& index,
+                                             batch_bool<double, A> const& mask, kernel::requires_arch<avx2>) noexcept
+        {
+            return _mm256_mask_i64gather_pd(fallback, src, index, mask, sizeof(double));
+        }
+
         // gather: handmade conversions
         template <class A, class V, detail::enable_sized_integral_t<V, 4> = 0>
         XSIMD_INLINE batch<float, A> gather(batch<float, A> const&, double const* src,
@@ -463,6 +634,100 @@ namespace xsimd
             }
         }
 
+        // load_interleaved
+        namespace detail
+        {
+            // batch I of the other layout gathers, from each batch J, the
+            // lanes selected for it after a cross-lane permutation
+            template <bool Store, std::size_t N, std::size_t I, class A, class T, std::size_t... Js>
+            XSIMD_INLINE batch<T, A> interleaved_permute(std::array<batch<T, A>, N> const& in, ::xsimd::detail::index_sequence<Js...>) noexcept
+            {
+                using index_type = as_unsigned_integer_t<T>;
+                batch<T, A> res = swizzle(in[0], make_batch_constant<index_type, A, interleaved_index<index_type, Store, N, I, 0>>());
+                (void)std::initializer_list<bool> { (Js == 0 || (res = select(make_batch_bool_constant<T, A, interleaved_select<Store, N, I, Js>>(), swizzle(in[Js], make_batch_constant<index_type, A, interleaved_index<index_type, Store, N, I, Js>>()), res), true))... };
+                return res;
+            }
+
+            template <bool Store, class A, class T, std::size_t N, std::size_t... Is>
+            XSIMD_INLINE void interleaved_permutes(std::array<batch<T, A>, N> const& in, std::array<batch<T, A>, N>& out, ::xsimd::detail::index_sequence<Is...>) noexcept
+            {
+                (void)std::initializer_list<bool> { (out[Is] = interleaved_permute<Store, N, Is>(in, ::xsimd::detail::make_index_sequence<N>()), true)... };
+            }
+        }
+
+        template <class A, class T, detail::enable_max_sized_integral_t<T, 2> = 0>
+        XSIMD_INLINE void load_interleaved(T const* mem, std::array<batch<T, A>, 2>& channels, requires_arch<avx2>) noexcept
+        {
+            // narrow the even and the odd elements of each word in each
+            // 128 bit lane, then restore the order of the 64 bit quarters
+            __m256i a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(mem));
+            __m256i b = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(mem) + 1);
+            __m256i even, odd;
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 1)
+            {
+                __m256i low = _mm256_set1_epi16(0x00FF);
+                even = _mm256_packus_epi16(_mm256_and_si256(a, low), _mm256_and_si256(b, low));
+                odd = _mm256_packus_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+            }
+            else
+            {
+                even = _mm256_packs_epi32(_mm256_srai_epi32(_mm256_slli_epi32(a, 16), 16), _mm256_srai_epi32(_mm256_slli_epi32(b, 16), 16));
+                odd = _mm256_packs_epi32(_mm256_srai_epi32(a, 16), _mm256_srai_epi32(b, 16));
+            }
+            channels[0] = _mm256_permute4x64_epi64(even, _MM_SHUFFLE(3, 1, 2, 0));
+            channels[1] = _mm256_permute4x64_epi64(odd, _MM_SHUFFLE(3, 1, 2, 0));
+        }
+
+        // pairs and quadruplets of 32 and 64 bit elements are faster
+        // deinterleaved in each 128 bit lane by the avx kernel
+        template <class A, class T, std::size_t N, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8) && N != 2 && N != 4, void>::type>
+        XSIMD_INLINE void load_interleaved(T const* mem, std::array<batch<T, A>, N>& channels, requires_arch<avx2>) noexcept
+        {
+            std::array<batch<T, A>, N> in;
+            for (std::size_t k = 0; k < N; ++k)
+                in[k] = batch<T, A>::load_unaligned(mem + k * batch<T, A>::size);
+            detail::interleaved_permutes<false>(in, channels, ::xsimd::detail::make_index_sequence<N>());
+        }
+
+        // load_strided
+        namespace detail
+        {
+            template <class T, class A>
+            XSIMD_INLINE batch<as_integer_t<T>, A> strided_offsets(int32_t stride, requires_arch<avx2>) noexcept
+            {
+                XSIMD_IF_CONSTEXPR(sizeof(T) == 4)
+                {
+                    return _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(stride));
+                }
+                else
+                {
+                    return _mm256_cvtepi32_epi64(_mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(stride)));
+                }
+            }
+        }
+
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE batch<T, A> load_strided(T const* mem, std::ptrdiff_t stride, requires_arch<avx2>) noexcept
+        {
+            // the offsets are computed on 32 bits
+            constexpr std::ptrdiff_t limit = std::numeric_limits<int32_t>::max() / (batch<T, A>::size - 1);
+            if (stride < -limit || stride > limit)
+                return load_strided<A>(mem, stride, generic {});
+            return gather(batch<T, A> {}, mem, detail::strided_offsets<T, A>(static_cast<int32_t>(stride), avx2 {}), A {});
+        }
+
+        // load_unaligned
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_unaligned(bfloat16 const* mem, convert<float>, requires_arch<avx2>) noexcept
+        {
+            return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i const*)mem)), 16));
+        }
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_aligned(bfloat16 const* mem, convert<float>, requires_arch<avx2>) noexcept
+        {
+            return load_unaligned<A>(mem, convert<float> {}, avx2 {});
+        }
+
         // load_complex
         template <class A>
         XSIMD_INLINE batch<std::complex<float>, A> load_complex(batch<float, A> const& hi, batch<float, A> const& lo, requires_arch<avx2>) noexcept
@@ -848,6 +1113,60 @@ namespace xsimd
             }
         }
 
+        // store_interleaved
+        template <class A, class T, detail::enable_max_sized_integral_t<T, 2> = 0>
+        XSIMD_INLINE void store_interleaved(T* mem, std::array<batch<T, A>, 2> const& channels, requires_arch<avx2>) noexcept
+        {
+            __m256i low, high;
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 1)
+            {
+                low = _mm256_unpacklo_epi8(channels[0], channels[1]);
+                high = _mm256_unpackhi_epi8(channels[0], channels[1]);
+            }
+            else
+            {
+                low = _mm256_unpacklo_epi16(channels[0], channels[1]);
+                high = _mm256_unpackhi_epi16(channels[0], channels[1]);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(mem), _mm256_permute2x128_si256(low, high, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(mem) + 1, _mm256_permute2x128_si256(low, high, 0x31));
+        }
+        template <class A, class T, std::size_t N, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8) && N != 2 && N != 4, void>::type>
+        XSIMD_INLINE void store_interleaved(T* mem, std::array<batch<T, A>, N> const& channels, requires_arch<avx2>) noexcept
+        {
+            std::array<batch<T, A>, N> out;
+            detail::interleaved_permutes<true>(channels, out, ::xsimd::detail::make_index_sequence<N>());
+            for (std::size_t k = 0; k < N; ++k)
+                out[k].store_unaligned(mem + k * batch<T, A>::size);
+        }
+
+        // store_unaligned
+        template <class A>
+        XSIMD_INLINE void store_unaligned(bfloat16* mem, batch<float, A> const& self, requires_arch<avx2>) noexcept
+        {
+            // the arithmetic shift keeps the packed values in int16 range
+            __m256i hi = _mm256_srai_epi32(detail::float_to_bfloat16(self), 16);
+            _mm_storeu_si128((__m128i*)mem, _mm_packs_epi32(_mm256_castsi256_si128(hi), _mm256_extracti128_si256(hi, 1)));
+        }
+        template <class A>
+        XSIMD_INLINE void store_aligned(bfloat16* mem, batch<float, A> const& self, requires_arch<avx2>) noexcept
+        {
+            store_unaligned<A>(mem, self, avx2 {});
+        }
+        template <class A>
+        XSIMD_INLINE std::array<batch<float, A>, 2> to_float(batch<bfloat16, A> const& self, requires_arch<avx2>) noexcept
+        {
+            return { _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(self)), 16)),
+                     _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(self, 1)), 16)) };
+        }
+        template <class A>
+        XSIMD_INLINE batch<bfloat16, A> to_bfloat16(batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<avx2>) noexcept
+        {
+            // packs works within 128 bit lanes, the permute restores the slot order
+            __m256i packed = _mm256_packs_epi32(_mm256_srai_epi32(detail::float_to_bfloat16(lo), 16), _mm256_srai_epi32(detail::float_to_bfloat16(hi), 16));
+            return _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+        }
+
         // sub
         template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
         XSIMD_INLINE batch<T, A> sub(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx2>) noexcept
@@ -0,0 +1,35 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#ifndef XSIMD_AVX512BF16_HPP
+#define XSIMD_AVX512BF16_HPP
+
+#include <type_traits>
+
+#include "../types/xsimd_avx512bf16_register.hpp"
+
+namespace xsimd
+{
+
+    namespace kernel
+    {
+        using namespace types;
+
+        // bf16_dot
+        template <class A>
+        XSIMD_INLINE batch<float, A> bf16_dot(batch<float, A> const& acc, batch<bfloat16, A> const& x, batch<bfloat16, A> const& y, requires_arch<avx512bf16>) noexcept
+        {
+            return _mm512_dpbf16_ps(acc, (__m512bh)x.data, (__m512bh)y.data);
+        }
+    }
+}
+
+#endif
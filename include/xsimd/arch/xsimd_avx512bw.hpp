@@ -224,6 +224,13 @@ namespace xsimd
             }
         }
 
+        // dot_accumulate
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<int16_t, A> const& x, batch<int16_t, A> const& y, requires_arch<avx512bw>) noexcept
+        {
+            return _mm512_add_epi32(acc, _mm512_madd_epi16(x, y));
+        }
+
         // eq
         template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
         XSIMD_INLINE batch_bool<T, A> eq(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx512bw>) noexcept
@@ -259,6 +266,58 @@ namespace xsimd
             return detail::compare_int_avx512bw<A, T, _MM_CMPINT_LT>(self, other);
         }
 
+        // load_interleaved
+        template <class A, class T, detail::enable_max_sized_integral_t<T, 2> = 0>
+        XSIMD_INLINE void load_interleaved(T const* mem, std::array<batch<T, A>, 2>& channels, requires_arch<avx512bw>) noexcept
+        {
+            // narrow the even and the odd elements of each word in each
+            // 128 bit lane, then restore the order of the 64 bit quarters
+            __m512i a = _mm512_loadu_si512(mem);
+            __m512i b = _mm512_loadu_si512(mem + batch<T, A>::size);
+            __m512i even, odd;
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 1)
+            {
+                __m512i low = _mm512_set1_epi16(0x00FF);
+                even = _mm512_packus_epi16(_mm512_and_si512(a, low), _mm512_and_si512(b, low));
+                odd = _mm512_packus_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8));
+            }
+            else
+            {
+                even = _mm512_packs_epi32(_mm512_srai_epi32(_mm512_slli_epi32(a, 16), 16), _mm512_srai_epi32(_mm512_slli_epi32(b, 16), 16));
+                odd = _mm512_packs_epi32(_mm512_srai_epi32(a, 16), _mm512_srai_epi32(b, 16));
+            }
+            __m512i order = _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7);
+            channels[0] = _mm512_permutexvar_epi64(order, even);
+            channels[1] = _mm512_permutexvar_epi64(order, odd);
+        }
+
+        // load_masked
+        template <class A, class T, detail::enable_sized_integral_t<T, 1> = 0>
+        XSIMD_INLINE batch<T, A> load_masked(T const* mem, batch_bool<T, A> const& mask, requires_arch<avx512bw>) noexcept
+        {
+            return _mm512_maskz_loadu_epi8(mask, mem);
+        }
+        template <class A, class T, detail::enable_sized_integral_t<T, 2> = 0>
+        XSIMD_INLINE batch<T, A> load_masked(T const* mem, batch_bool<T, A> const& mask, requires_arch<avx512bw>) noexcept
+        {
+            return _mm512_maskz_loadu_epi16(mask, mem);
+        }
+
+        // load_partial
+        namespace detail
+        {
+            XSIMD_INLINE uint64_t avx512_partial_mask(std::size_t n) noexcept
+            {
+                return n >= 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1u;
+            }
+        }
+        template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value && sizeof(T) <= 2, void>::type>
+        XSIMD_INLINE batch<T, A> load_partial(T const* mem, std::size_t n, requires_arch<avx512bw>) noexcept
+        {
+            using register_type = typename batch_bool<T, A>::register_type;
+            return load_masked<A>(mem, batch_bool<T, A>(static_cast<register_type>(detail::avx512_partial_mask(n))), A {});
+        }
+
         // max
         template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
         XSIMD_INLINE batch<T, A> max(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx512bw>) noexcept
@@ -358,6 +417,21 @@ namespace xsimd
             return detail::compare_int_avx512bw<A, T, _MM_CMPINT_NE>(self, other);
         }
 
+        // prefix_sum
+        template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
+        XSIMD_INLINE batch<T, A> prefix_sum(batch<T, A> const& self, requires_arch<avx512bw>) noexcept
+        {
+            XSIMD_IF_CONSTEXPR(sizeof(T) <= 2)
+            {
+                // shift and add on top of the cross lane slide_left
+                return prefix_sum(self, generic {});
+            }
+            else
+            {
+                return prefix_sum(self, avx512dq {});
+            }
+        }
+
         // rotate_right
         template <size_t N, class A>
         XSIMD_INLINE batch<uint16_t, A> rotate_right(batch<uint16_t, A> const& self, requires_arch<avx512bw>) noexcept
@@ -572,6 +646,45 @@ namespace xsimd
             }
         }
 
+        // store_interleaved
+        template <class A, class T, detail::enable_max_sized_integral_t<T, 2> = 0>
+        XSIMD_INLINE void store_interleaved(T* mem, std::array<batch<T, A>, 2> const& channels, requires_arch<avx512bw>) noexcept
+        {
+            __m512i low, high;
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 1)
+            {
+                low = _mm512_unpacklo_epi8(channels[0], channels[1]);
+                high = _mm512_unpackhi_epi8(channels[0], channels[1]);
+            }
+            else
+            {
+                low = _mm512_unpacklo_epi16(channels[0], channels[1]);
+                high = _mm512_unpackhi_epi16(channels[0], channels[1]);
+            }
+            _mm512_storeu_si512(mem, _mm512_permutex2var_epi64(low, _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11), high));
+            _mm512_storeu_si512(mem + batch<T, A>::size, _mm512_permutex2var_epi64(low, _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15), high));
+        }
+
+        // store_masked
+        template <class A, class T, detail::enable_sized_integral_t<T, 1> = 0>
+        XSIMD_INLINE void store_masked(T* mem, batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<avx512bw>) noexcept
+        {
+            _mm512_mask_storeu_epi8(mem, mask, self);
+        }
+        template <class A, class T, detail::enable_sized_integral_t<T, 2> = 0>
+        XSIMD_INLINE void store_masked(T* mem, batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<avx512bw>) noexcept
+        {
+            _mm512_mask_storeu_epi16(mem, mask, self);
+        }
+
+        // store_partial
+        template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value && sizeof(T) <= 2, void>::type>
+        XSIMD_INLINE void store_partial(T* mem, batch<T, A> const& self, std::size_t n, requires_arch<avx512bw>) noexcept
+        {
+            using register_type = typename batch_bool<T, A>::register_type;
+            store_masked<A>(mem, self, batch_bool<T, A>(static_cast<register_type>(detail::avx512_partial_mask(n))), A {});
+        }
+
         // sub
         template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
         XSIMD_INLINE batch<T, A> sub(batch<T, A> const& self, batch<T, A> const& other, requires_arch<avx512bw>) noexcept
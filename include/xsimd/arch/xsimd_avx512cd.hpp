@@ -19,8 +19,64 @@ namespace xsimd
 
     namespace kernel
     {
-        // Nothing there yet.
+        using namespace types;
 
+        // conflict
+        template <class A, class T, detail::enable_sized_integral_t<T, 4> = 0>
+        XSIMD_INLINE batch<T, A> conflict(batch<T, A> const& self, requires_arch<avx512cd>) noexcept
+        {
+            return _mm512_conflict_epi32(self);
+        }
+
+        template <class A, class T, detail::enable_sized_integral_t<T, 8> = 0>
+        XSIMD_INLINE batch<T, A> conflict(batch<T, A> const& self, requires_arch<avx512cd>) noexcept
+        {
+            return _mm512_conflict_epi64(self);
+        }
+
+        // scatter_add
+        //
+        // Colliding slots are first combined in-register: each slot is
+        // repeatedly added the value of the closest previous slot sharing its
+        // index (found through vpconflict + vplzcnt), doubling the distance
+        // covered at each step. The last slot of each index then holds the
+        // total, and since the scatter writes slots in increasing order, it
+        // is the one that ends up in memory.
+        template <class A, class T, class V, detail::enable_sized_t<T, 4> = 0, detail::enable_sized_integral_t<V, 4> = 0>
+        XSIMD_INLINE void scatter_add(T* dst, batch<V, A> const& index, batch<T, A> const& values, requires_arch<avx512cd>) noexcept
+        {
+            __m512i conflicts = _mm512_conflict_epi32(index);
+            __m512i none = _mm512_set1_epi32(-1);
+            __m512i prev = _mm512_sub_epi32(_mm512_set1_epi32(31), _mm512_lzcnt_epi32(conflicts));
+            __mmask16 todo = _mm512_test_epi32_mask(conflicts, conflicts);
+            batch<T, A> acc = values;
+            while (todo)
+            {
+                batch<T, A> shifted = swizzle(acc, batch<uint32_t, A>(prev), A {});
+                acc = select(batch_bool<T, A>(todo), acc + shifted, acc);
+                prev = _mm512_mask_permutexvar_epi32(prev, todo, prev, prev);
+                todo = _mm512_mask_cmpneq_epi32_mask(todo, prev, none);
+            }
+            (batch<T, A>::gather(dst, index) + acc).scatter(dst, index);
+        }
+
+        template <class A, class T, class V, detail::enable_sized_t<T, 8> = 0, detail::enable_sized_integral_t<V, 8> = 0>
+        XSIMD_INLINE void scatter_add(T* dst, batch<V, A> const& index, batch<T, A> const& values, requires_arch<avx512cd>) noexcept
+        {
+            __m512i conflicts = _mm512_conflict_epi64(index);
+            __m512i none = _mm512_set1_epi64(-1);
+            __m512i prev = _mm512_sub_epi64(_mm512_set1_epi64(63), _mm512_lzcnt_epi64(conflicts));
+            __mmask8 todo = _mm512_test_epi64_mask(conflicts, conflicts);
+            batch<T, A> acc = values;
+            while (todo)
+            {
+                batch<T, A> shifted = swizzle(acc, batch<uint64_t, A>(prev), A {});
+                acc = select(batch_bool<T, A>(todo), acc + shifted, acc);
+                prev = _mm512_mask_permutexvar_epi64(prev, todo, prev, prev);
+                todo = _mm512_mask_cmpneq_epi64_mask(todo, prev, none);
+            }
+            (batch<T, A>::gather(dst, index) + acc).scatter(dst, index);
+        }
     }
 
 }
@@ -12,6 +12,7 @@
 #ifndef XSIMD_AVX512F_HPP
 #define XSIMD_AVX512F_HPP
 
+#include <array>
 #include <complex>
 #include <limits>
 #include <type_traits>
@@ -693,6 +694,37 @@ namespace xsimd
             return _mm512_maskz_compress_epi64(mask.mask(), self);
         }
 
+        // compress_store
+        template <class A>
+        XSIMD_INLINE std::size_t compress_store(float* mem, batch<float, A> const& self, batch_bool<float, A> const& mask, requires_arch<avx512f>) noexcept
+        {
+            _mm512_mask_compressstoreu_ps(mem, mask.mask(), self);
+            return ::xsimd::detail::popcount(mask.mask());
+        }
+        template <class A>
+        XSIMD_INLINE std::size_t compress_store(double* mem, batch<double, A> const& self, batch_bool<double, A> const& mask, requires_arch<avx512f>) noexcept
+        {
+            _mm512_mask_compressstoreu_pd(mem, mask.mask(), self);
+            return ::xsimd::detail::popcount(mask.mask());
+        }
+        template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
+        XSIMD_INLINE std::size_t compress_store(T* mem, batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<avx512f>) noexcept
+        {
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 4)
+            {
+                _mm512_mask_compressstoreu_epi32(mem, mask.mask(), self);
+            }
+            else XSIMD_IF_CONSTEXPR(sizeof(T) == 8)
+            {
+                _mm512_mask_compressstoreu_epi64(mem, mask.mask(), self);
+            }
+            else
+            {
+                return compress_store(mem, self, mask, generic {});
+            }
+            return ::xsimd::detail::popcount(mask.mask());
+        }
+
         // convert
         namespace detail
         {
@@ -820,6 +852,34 @@ namespace xsimd
             return _mm512_maskz_expand_epi64(mask.mask(), self);
         }
 
+        // expand_load
+        template <class A>
+        XSIMD_INLINE batch<float, A> expand_load(float const* mem, batch_bool<float, A> const& mask, batch<float, A> const& src, requires_arch<avx512f>) noexcept
+        {
+            return _mm512_mask_expandloadu_ps(src, mask.mask(), mem);
+        }
+        template <class A>
+        XSIMD_INLINE batch<double, A> expand_load(double const* mem, batch_bool<double, A> const& mask, batch<double, A> const& src, requires_arch<avx512f>) noexcept
+        {
+            return _mm512_mask_expandloadu_pd(src, mask.mask(), mem);
+        }
+        template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
+        XSIMD_INLINE batch<T, A> expand_load(T const* mem, batch_bool<T, A> const& mask, batch<T, A> const& src, requires_arch<avx512f>) noexcept
+        {
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 4)
+            {
+                return _mm512_mask_expandloadu_epi32(src, mask.mask(), mem);
+            }
+            else XSIMD_IF_CONSTEXPR(sizeof(T) == 8)
+            {
+                return _mm512_mask_expandloadu_epi64(src, mask.mask(), mem);
+            }
+            else
+            {
+                return expand_load(mem, mask, src, generic {});
+            }
+        }
+
         // floor
         template <class A>
         XSIMD_INLINE batch<float, A> floor(batch<float, A> const& self, requires_arch<avx512f>) noexcept
@@ -916,6 +976,35 @@ namespace xsimd
             return _mm512_i64gather_pd(index, src, sizeof(double));
         }
 
+        // gather: masked
+        template <class T, class A, class U, detail::enable_sized_integral_t<T, 4> = 0, detail::enable_sized_integral_t<U, 4> = 0>
+        XSIMD_INLINE batch<T, A> gather(batch<T, A> const& fallback, T const* src, batch<U, A> const& index,
+                                        batch_bool<T, A> const& mask, kernel::requires_arch<avx512f>) noexcept
+        {
+            return _mm512_mask_i32gather_epi32(fallback, mask, index, static_cast<const void*>(src), sizeof(T));
+        }
+
+        template <class T, class A, class U, detail::enable_sized_integral_t<T, 8> = 0, detail::enable_sized_integral_t<U, 8> = 0>
+        XSIMD_INLINE batch<T, A> gather(batch<T, A> const& fallback, T const* src, batch<U, A> const& index,
+                                        batch_bool<T, A> const& mask, kernel::requires_arch<avx512f>) noexcept
+        {
+            return _mm512_mask_i64gather_epi64(fallback, mask, index, static_cast<const void*>(src), sizeof(T));
+        }
+
+        template <class A, class U, detail::enable_sized_integral_t<U, 4> = 0>
+        XSIMD_INLINE batch<float, A> gather(batch<float, A> const& fallback, float const* src, batch<U, A> const& index,
+                                            batch_bool<float, A> const& mask, kernel::requires_arch<avx512f>) noexcept
+        {
+            return _mm512_mask_i32gather_ps(fallback, mask, index, src, sizeof(float));
+        }
+
+        template <class A, class U, detail::enable_sized_integral_t<U, 8> = 0>
+        XSIMD_INLINE batch<double, A> gather(batch<double, A> const& fallback, double const* src, batch<U, A> const& index,
+                                             batch_bool<double, A> const& mask, kernel::requires_arch<avx512f>) noexcept
+        {
+            return _mm512_mask_i64gather_pd(fallback, mask, index, src, sizeof(double));
+        }
+
         // gather: handmade conversions
         template <class A, class V, detail::enable_sized_integral_t<V, 4> = 0>
         XSIMD_INLINE batch<float, A> gather(batch<float, A> const&, double const* src,
@@ -1152,6 +1241,74 @@ namespace xsimd
             }
         }
 
+        // load_interleaved
+        template <class A, class T, std::size_t N, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE void load_interleaved(T const* mem, std::array<batch<T, A>, N>& channels, requires_arch<avx512f>) noexcept
+        {
+            std::array<batch<T, A>, N> in;
+            for (std::size_t k = 0; k < N; ++k)
+                in[k] = batch<T, A>::load_unaligned(mem + k * batch<T, A>::size);
+            detail::interleaved_permutes<false>(in, channels, ::xsimd::detail::make_index_sequence<N>());
+        }
+        template <class A, class T, std::size_t N, detail::enable_max_sized_integral_t<T, 2> = 0>
+        XSIMD_INLINE void load_interleaved(T const* mem, std::array<batch<T, A>, N>& channels, requires_arch<avx512f>) noexcept
+        {
+            // deinterleave each half with the AVX2 kernels
+            using half_batch = batch<T, avx2>;
+            std::array<half_batch, N> low, high;
+            load_interleaved<avx2>(mem, low, avx2 {});
+            load_interleaved<avx2>(mem + N * half_batch::size, high, avx2 {});
+            for (std::size_t c = 0; c < N; ++c)
+                channels[c] = detail::merge_avx(low[c], high[c]);
+        }
+
+        // load_masked
+        template <class A, class T, detail::enable_sized_t<T, 4> = 0>
+        XSIMD_INLINE batch<T, A> load_masked(T const* mem, batch_bool<T, A> const& mask, requires_arch<avx512f>) noexcept
+        {
+            return bitwise_cast<T>(batch<float, A>(_mm512_maskz_loadu_ps(mask, reinterpret_cast<float const*>(mem))));
+        }
+        template <class A, class T, detail::enable_sized_t<T, 8> = 0>
+        XSIMD_INLINE batch<T, A> load_masked(T const* mem, batch_bool<T, A> const& mask, requires_arch<avx512f>) noexcept
+        {
+            return bitwise_cast<T>(batch<double, A>(_mm512_maskz_loadu_pd(mask, reinterpret_cast<double const*>(mem))));
+        }
+
+        // load_partial
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE batch<T, A> load_partial(T const* mem, std::size_t n, requires_arch<avx512f>) noexcept
+        {
+            using register_type = typename batch_bool<T, A>::register_type;
+            return load_masked<A>(mem, batch_bool<T, A>(static_cast<register_type>((1u << n) - 1u)), A {});
+        }
+
+        // load_strided
+        namespace detail
+        {
+            template <class T, class A>
+            XSIMD_INLINE batch<as_integer_t<T>, A> strided_offsets(int32_t stride, requires_arch<avx512f>) noexcept
+            {
+                XSIMD_IF_CONSTEXPR(sizeof(T) == 4)
+                {
+                    return _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(stride));
+                }
+                else
+                {
+                    return _mm512_cvtepi32_epi64(_mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(stride)));
+                }
+            }
+        }
+
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE batch<T, A> load_strided(T const* mem, std::ptrdiff_t stride, requires_arch<avx512f>) noexcept
+        {
+            // the offsets are computed on 32 bits
+            constexpr std::ptrdiff_t limit = std::numeric_limits<int32_t>::max() / (batch<T, A>::size - 1);
+            if (stride < -limit || stride > limit)
+                return load_strided<A>(mem, stride, generic {});
+            return gather(batch<T, A> {}, mem, detail::strided_offsets<T, A>(static_cast<int32_t>(stride), avx512f {}), A {});
+        }
+
         // load_unaligned
         template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
         XSIMD_INLINE batch<T, A> load_unaligned(T const* mem, convert<T>, requires_arch<avx512f>) noexcept
@@ -1168,6 +1325,26 @@ namespace xsimd
         {
             return _mm512_loadu_pd(mem);
         }
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_unaligned(float16 const* mem, convert<float>, requires_arch<avx512f>) noexcept
+        {
+            return _mm512_cvtph_ps(_mm256_loadu_si256((__m256i const*)mem));
+        }
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_aligned(float16 const* mem, convert<float>, requires_arch<avx512f>) noexcept
+        {
+            return load_unaligned<A>(mem, convert<float> {}, avx512f {});
+        }
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_unaligned(bfloat16 const* mem, convert<float>, requires_arch<avx512f>) noexcept
+        {
+            return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((__m256i const*)mem)), 16));
+        }
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_aligned(bfloat16 const* mem, convert<float>, requires_arch<avx512f>) noexcept
+        {
+            return load_unaligned<A>(mem, convert<float> {}, avx512f {});
+        }
 
         // lt
         template <class A>
@@ -1371,6 +1548,48 @@ namespace xsimd
             return register_type(self.data ^ other.data);
         }
 
+        // prefetch
+        template <class A, int Locality>
+        XSIMD_INLINE void prefetch(void const* ptr, requires_arch<avx512f>) noexcept
+        {
+            prefetch<A, Locality>(ptr, sse2 {});
+        }
+
+        // prefix_sum
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value, void>::type>
+        XSIMD_INLINE batch<T, A> prefix_sum(batch<T, A> const& self, requires_arch<avx512f>) noexcept
+        {
+            // valignd / valignq shift the whole register by a number of
+            // slots, the zero operand fills the lower slots
+            __m512i zero = _mm512_setzero_si512();
+            batch<T, A> res = self;
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 4)
+            {
+                using int_batch = batch<uint32_t, A>;
+                res += bitwise_cast<T>(int_batch(_mm512_alignr_epi32(bitwise_cast<uint32_t>(res), zero, 15)));
+                res += bitwise_cast<T>(int_batch(_mm512_alignr_epi32(bitwise_cast<uint32_t>(res), zero, 14)));
+                res += bitwise_cast<T>(int_batch(_mm512_alignr_epi32(bitwise_cast<uint32_t>(res), zero, 12)));
+                res += bitwise_cast<T>(int_batch(_mm512_alignr_epi32(bitwise_cast<uint32_t>(res), zero, 8)));
+            }
+            else XSIMD_IF_CONSTEXPR(sizeof(T) == 8)
+            {
+                using int_batch = batch<uint64_t, A>;
+                res += bitwise_cast<T>(int_batch(_mm512_alignr_epi64(bitwise_cast<uint64_t>(res), zero, 7)));
+                res += bitwise_cast<T>(int_batch(_mm512_alignr_epi64(bitwise_cast<uint64_t>(res), zero, 6)));
+                res += bitwise_cast<T>(int_batch(_mm512_alignr_epi64(bitwise_cast<uint64_t>(res), zero, 4)));
+            }
+            else
+            {
+                // no cross lane shift of 8 and 16 bit slots without AVX512BW
+                alignas(A::alignment()) T buffer[batch<T, A>::size];
+                res.store_aligned(buffer);
+                for (std::size_t i = 1; i < batch<T, A>::size; ++i)
+                    buffer[i] = static_cast<T>(buffer[i] + buffer[i - 1]);
+                res = batch<T, A>::load_aligned(buffer);
+            }
+            return res;
+        }
+
         // reciprocal
         template <class A>
         XSIMD_INLINE batch<float, A>
@@ -1815,6 +2034,86 @@ namespace xsimd
             return _mm512_store_pd(mem, self);
         }
 
+        // store_interleaved
+        template <class A, class T, std::size_t N, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE void store_interleaved(T* mem, std::array<batch<T, A>, N> const& channels, requires_arch<avx512f>) noexcept
+        {
+            std::array<batch<T, A>, N> out;
+            detail::interleaved_permutes<true>(channels, out, ::xsimd::detail::make_index_sequence<N>());
+            for (std::size_t k = 0; k < N; ++k)
+                out[k].store_unaligned(mem + k * batch<T, A>::size);
+        }
+        template <class A, class T, std::size_t N, detail::enable_max_sized_integral_t<T, 2> = 0>
+        XSIMD_INLINE void store_interleaved(T* mem, std::array<batch<T, A>, N> const& channels, requires_arch<avx512f>) noexcept
+        {
+            using half_batch = batch<T, avx2>;
+            std::array<half_batch, N> low, high;
+            for (std::size_t c = 0; c < N; ++c)
+            {
+                typename half_batch::register_type l, h;
+                detail::split_avx512(channels[c], l, h);
+                low[c] = l;
+                high[c] = h;
+            }
+            store_interleaved<avx2>(mem, low, avx2 {});
+            store_interleaved<avx2>(mem + N * half_batch::size, high, avx2 {});
+        }
+
+        // store_masked
+        template <class A, class T, detail::enable_sized_t<T, 4> = 0>
+        XSIMD_INLINE void store_masked(T* mem, batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<avx512f>) noexcept
+        {
+            _mm512_mask_storeu_ps(reinterpret_cast<float*>(mem), mask, bitwise_cast<float>(self));
+        }
+        template <class A, class T, detail::enable_sized_t<T, 8> = 0>
+        XSIMD_INLINE void store_masked(T* mem, batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<avx512f>) noexcept
+        {
+            _mm512_mask_storeu_pd(reinterpret_cast<double*>(mem), mask, bitwise_cast<double>(self));
+        }
+
+        // store_partial
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE void store_partial(T* mem, batch<T, A> const& self, std::size_t n, requires_arch<avx512f>) noexcept
+        {
+            using register_type = typename batch_bool<T, A>::register_type;
+            store_masked<A>(mem, self, batch_bool<T, A>(static_cast<register_type>((1u << n) - 1u)), A {});
+        }
+
+        // store_stream
+        template <class A>
+        XSIMD_INLINE void store_stream(float* mem, batch<float, A> const& self, requires_arch<avx512f>) noexcept
+        {
+            _mm512_stream_ps(mem, self);
+        }
+        template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
+        XSIMD_INLINE void store_stream(T* mem, batch<T, A> const& self, requires_arch<avx512f>) noexcept
+        {
+            _mm512_stream_si512((__m512i*)mem, self);
+        }
+        template <class A>
+        XSIMD_INLINE void store_stream(double* mem, batch<double, A> const& self, requires_arch<avx512f>) noexcept
+        {
+            _mm512_stream_pd(mem, self);
+        }
+
+        // stream_fence
+        template <class A>
+        XSIMD_INLINE void stream_fence(requires_arch<avx512f>) noexcept
+        {
+            _mm_sfence();
+        }
+
+        // store_strided
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE void store_strided(T* mem, batch<T, A> const& self, std::ptrdiff_t stride, requires_arch<avx512f>) noexcept
+        {
+            // the offsets are computed on 32 bits
+            constexpr std::ptrdiff_t limit = std::numeric_limits<int32_t>::max() / (batch<T, A>::size - 1);
+            if (stride < -limit || stride > limit)
+                return store_strided<A>(mem, self, stride, generic {});
+            scatter(self, mem, detail::strided_offsets<T, A>(static_cast<int32_t>(stride), avx512f {}), A {});
+        }
+
         // store_unaligned
         template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
         XSIMD_INLINE void store_unaligned(T* mem, batch<T, A> const& self, requires_arch<avx512f>) noexcept
@@ -1836,6 +2135,48 @@ namespace xsimd
         {
             return _mm512_storeu_pd(mem, self);
         }
+        template <class A>
+        XSIMD_INLINE void store_unaligned(float16* mem, batch<float, A> const& self, requires_arch<avx512f>) noexcept
+        {
+            _mm256_storeu_si256((__m256i*)mem, _mm512_cvtps_ph(self, _MM_FROUND_TO_NEAREST_INT));
+        }
+        template <class A>
+        XSIMD_INLINE void store_aligned(float16* mem, batch<float, A> const& self, requires_arch<avx512f>) noexcept
+        {
+            store_unaligned<A>(mem, self, avx512f {});
+        }
+        template <class A>
+        XSIMD_INLINE std::array<batch<float, A>, 2> to_float(batch<float16, A> const& self, requires_arch<avx512f>) noexcept
+        {
+            return { _mm512_cvtph_ps(_mm512_castsi512_si256(self)), _mm512_cvtph_ps(_mm512_extracti64x4_epi64(self, 1)) };
+        }
+        template <class A>
+        XSIMD_INLINE batch<float16, A> to_float16(batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<avx512f>) noexcept
+        {
+            return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtps_ph(lo, _MM_FROUND_TO_NEAREST_INT)), _mm512_cvtps_ph(hi, _MM_FROUND_TO_NEAREST_INT), 1);
+        }
+        template <class A>
+        XSIMD_INLINE void store_unaligned(bfloat16* mem, batch<float, A> const& self, requires_arch<avx512f>) noexcept
+        {
+            _mm256_storeu_si256((__m256i*)mem, _mm512_cvtepi32_epi16(_mm512_srli_epi32(detail::float_to_bfloat16(self), 16)));
+        }
+        template <class A>
+        XSIMD_INLINE void store_aligned(bfloat16* mem, batch<float, A> const& self, requires_arch<avx512f>) noexcept
+        {
+            store_unaligned<A>(mem, self, avx512f {});
+        }
+        template <class A>
+        XSIMD_INLINE std::array<batch<float, A>, 2> to_float(batch<bfloat16, A> const& self, requires_arch<avx512f>) noexcept
+        {
+            return { _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm512_castsi512_si256(self)), 16)),
+                     _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm512_extracti64x4_epi64(self, 1)), 16)) };
+        }
+        template <class A>
+        XSIMD_INLINE batch<bfloat16, A> to_bfloat16(batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<avx512f>) noexcept
+        {
+            return _mm512_inserti64x4(_mm512_castsi256_si512(_mm512_cvtepi32_epi16(_mm512_srli_epi32(detail::float_to_bfloat16(lo), 16))),
+                                      _mm512_cvtepi32_epi16(_mm512_srli_epi32(detail::float_to_bfloat16(hi), 16)), 1);
+        }
 
         // sub
         template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
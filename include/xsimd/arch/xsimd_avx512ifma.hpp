@@ -9,12 +9,57 @@
  * The full license is in the file LICENSE, distributed with this software. *
  ****************************************************************************/
 
-#ifndef XSIMD_AVX512VBMI_HPP
-#define XSIMD_AVX512VBMI_HPP
+#ifndef XSIMD_AVX512IFMA_HPP
+#define XSIMD_AVX512IFMA_HPP
 
 #include <array>
 #include <type_traits>
 
-#include "../types/xsimd_avx512vbmi_register.hpp"
+#include "../types/xsimd_avx512ifma_register.hpp"
+
+namespace xsimd
+{
+
+    namespace kernel
+    {
+        using namespace types;
+
+        // madd52hi
+        template <class A>
+        XSIMD_INLINE batch<uint64_t, A> madd52hi(batch<uint64_t, A> const& self, batch<uint64_t, A> const& x, batch<uint64_t, A> const& y, requires_arch<avx512ifma>) noexcept
+        {
+            return _mm512_madd52hi_epu64(self, x, y);
+        }
+
+        // madd52lo
+        template <class A>
+        XSIMD_INLINE batch<uint64_t, A> madd52lo(batch<uint64_t, A> const& self, batch<uint64_t, A> const& x, batch<uint64_t, A> const& y, requires_arch<avx512ifma>) noexcept
+        {
+            return _mm512_madd52lo_epu64(self, x, y);
+        }
+
+        // mul_hi
+        template <class A>
+        XSIMD_INLINE batch<uint64_t, A> mul_hi(batch<uint64_t, A> const& self, batch<uint64_t, A> const& other, requires_arch<avx512ifma>) noexcept
+        {
+            // Split both operands as v = v1 * 2^52 + v0, with v1 on 12 bits.
+            // The 52 bit multiply-adds ignore the upper bits, so v0 is the
+            // operand itself. Partial products are summed by weight:
+            //   s1 = hi(x0 y0) + lo(x1 y0) + lo(x0 y1)   (weight 2^52)
+            //   s2 = hi(x1 y0) + hi(x0 y1) + x1 y1       (weight 2^104)
+            // and the low 52 bits of x0 y0 cannot carry into bit 64.
+            const __m512i zero = _mm512_setzero_si512();
+            __m512i self_hi = _mm512_srli_epi64(self, 52);
+            __m512i other_hi = _mm512_srli_epi64(other, 52);
+            __m512i s1 = _mm512_madd52hi_epu64(zero, self, other);
+            s1 = _mm512_madd52lo_epu64(s1, self_hi, other);
+            s1 = _mm512_madd52lo_epu64(s1, self, other_hi);
+            __m512i s2 = _mm512_madd52lo_epu64(zero, self_hi, other_hi);
+            s2 = _mm512_madd52hi_epu64(s2, self_hi, other);
+            s2 = _mm512_madd52hi_epu64(s2, self, other_hi);
+            return _mm512_add_epi64(_mm512_srli_epi64(s1, 12), _mm512_slli_epi64(s2, 40));
+        }
+    }
+}
 
 #endif
@@ -17,4 +17,65 @@
 
 #include "../types/xsimd_avx512vbmi_register.hpp"
 
+namespace xsimd
+{
+
+    namespace kernel
+    {
+        using namespace types;
+
+        // lookup
+        template <class A>
+        XSIMD_INLINE batch<uint8_t, A> lookup(batch<uint8_t, A> const& table_lo, batch<uint8_t, A> const& table_hi, batch<uint8_t, A> const& idx, requires_arch<avx512vbmi>) noexcept
+        {
+            return _mm512_permutex2var_epi8(table_lo, idx, table_hi);
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<int8_t, A> lookup(batch<int8_t, A> const& table_lo, batch<int8_t, A> const& table_hi, batch<uint8_t, A> const& idx, requires_arch<avx512vbmi>) noexcept
+        {
+            return bitwise_cast<int8_t>(lookup(bitwise_cast<uint8_t>(table_lo), bitwise_cast<uint8_t>(table_hi), idx, avx512vbmi {}));
+        }
+
+        // shuffle
+        template <class A, uint8_t... Indices>
+        XSIMD_INLINE batch<uint8_t, A> shuffle(batch<uint8_t, A> const& x, batch<uint8_t, A> const& y, batch_constant<uint8_t, A, Indices...> mask, requires_arch<avx512vbmi>) noexcept
+        {
+            return _mm512_permutex2var_epi8(x, mask.as_batch(), y);
+        }
+
+        template <class A, uint8_t... Indices>
+        XSIMD_INLINE batch<int8_t, A> shuffle(batch<int8_t, A> const& x, batch<int8_t, A> const& y, batch_constant<uint8_t, A, Indices...> mask, requires_arch<avx512vbmi>) noexcept
+        {
+            return bitwise_cast<int8_t>(shuffle(bitwise_cast<uint8_t>(x), bitwise_cast<uint8_t>(y), mask, avx512vbmi {}));
+        }
+
+        // swizzle (dynamic version)
+        template <class A>
+        XSIMD_INLINE batch<uint8_t, A> swizzle(batch<uint8_t, A> const& self, batch<uint8_t, A> mask, requires_arch<avx512vbmi>) noexcept
+        {
+            return _mm512_permutexvar_epi8(mask, self);
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<int8_t, A> swizzle(batch<int8_t, A> const& self, batch<uint8_t, A> mask, requires_arch<avx512vbmi>) noexcept
+        {
+            return bitwise_cast<int8_t>(swizzle(bitwise_cast<uint8_t>(self), mask, avx512vbmi {}));
+        }
+
+        // swizzle (static version)
+        template <class A, uint8_t... Vs>
+        XSIMD_INLINE batch<uint8_t, A> swizzle(batch<uint8_t, A> const& self, batch_constant<uint8_t, A, Vs...> mask, requires_arch<avx512vbmi>) noexcept
+        {
+            return swizzle(self, mask.as_batch(), avx512vbmi {});
+        }
+
+        template <class A, uint8_t... Vs>
+        XSIMD_INLINE batch<int8_t, A> swizzle(batch<int8_t, A> const& self, batch_constant<uint8_t, A, Vs...> mask, requires_arch<avx512vbmi>) noexcept
+        {
+            return swizzle(self, mask.as_batch(), avx512vbmi {});
+        }
+    }
+}
+
 #endif
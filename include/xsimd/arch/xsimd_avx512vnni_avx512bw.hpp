@@ -17,4 +17,27 @@
 
 #include "../types/xsimd_avx512vnni_avx512bw_register.hpp"
 
+namespace xsimd
+{
+
+    namespace kernel
+    {
+        using namespace types;
+
+        // dot_accumulate
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<uint8_t, A> const& x, batch<int8_t, A> const& y, requires_arch<avx512vnni<avx512bw>>) noexcept
+        {
+            return _mm512_dpbusd_epi32(acc, x, y);
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<int16_t, A> const& x, batch<int16_t, A> const& y, requires_arch<avx512vnni<avx512bw>>) noexcept
+        {
+            return _mm512_dpwssd_epi32(acc, x, y);
+        }
+    }
+
+}
+
 #endif
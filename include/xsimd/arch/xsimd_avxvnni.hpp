@@ -17,4 +17,27 @@
 
 #include "../types/xsimd_avxvnni_register.hpp"
 
+namespace xsimd
+{
+
+    namespace kernel
+    {
+        using namespace types;
+
+        // dot_accumulate
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<uint8_t, A> const& x, batch<int8_t, A> const& y, requires_arch<avxvnni>) noexcept
+        {
+            return _mm256_dpbusd_avx_epi32(acc, x, y);
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<int16_t, A> const& x, batch<int16_t, A> const& y, requires_arch<avxvnni>) noexcept
+        {
+            return _mm256_dpwssd_avx_epi32(acc, x, y);
+        }
+    }
+
+}
+
 #endif
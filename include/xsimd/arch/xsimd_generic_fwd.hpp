@@ -14,6 +14,8 @@
 
 #include "../types/xsimd_batch_constant.hpp"
 
+#include <array>
+#include <cstddef>
 #include <type_traits>
 
 namespace xsimd
@@ -37,7 +39,26 @@ namespace xsimd
         XSIMD_INLINE batch<T, A> ssub(batch<T, A> const& self, batch<T, A> const& other, requires_arch<generic>) noexcept;
         template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
         XSIMD_INLINE T hadd(batch<T, A> const& self, requires_arch<generic>) noexcept;
+        template <class A, class T>
+        XSIMD_INLINE batch<T, A> prefix_sum(batch<T, A> const& self, requires_arch<generic>) noexcept;
+        template <class A, class T>
+        XSIMD_INLINE std::size_t compress_store(T* mem, batch<T, A> const& self, batch_bool<T, A> const& mask, requires_arch<generic>) noexcept;
+        template <class A, class T>
+        XSIMD_INLINE batch<T, A> expand_load(T const* mem, batch_bool<T, A> const& mask, batch<T, A> const& src, requires_arch<generic>) noexcept;
+        template <class A, class T, std::size_t N>
+        XSIMD_INLINE void load_interleaved(T const* mem, std::array<batch<T, A>, N>& channels, requires_arch<generic>) noexcept;
+        template <class A, class T, std::size_t N>
+        XSIMD_INLINE void store_interleaved(T* mem, std::array<batch<T, A>, N> const& channels, requires_arch<generic>) noexcept;
+        template <class A, class T>
+        XSIMD_INLINE batch<T, A> load_strided(T const* mem, std::ptrdiff_t stride, requires_arch<generic>) noexcept;
+        template <class A, class T>
+        XSIMD_INLINE void store_strided(T* mem, batch<T, A> const& self, std::ptrdiff_t stride, requires_arch<generic>) noexcept;
 
+        namespace detail
+        {
+            template <class A>
+            XSIMD_INLINE batch<uint32_t, A> float_to_bfloat16(batch<float, A> const& f) noexcept;
+        }
     }
 }
 
@@ -14,4 +14,44 @@
 
 #include "../types/xsimd_i8mm_neon64_register.hpp"
 
+namespace xsimd
+{
+    namespace kernel
+    {
+        using namespace types;
+
+        /******************
+         * dot_accumulate *
+         ******************/
+
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<uint8_t, A> const& x, batch<int8_t, A> const& y, requires_arch<i8mm<neon64>>) noexcept
+        {
+            return vusdotq_s32(acc, x, y);
+        }
+
+        /********
+         * mmla *
+         ********/
+
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> mmla(batch<int32_t, A> const& acc, batch<int8_t, A> const& x, batch<int8_t, A> const& y, requires_arch<i8mm<neon64>>) noexcept
+        {
+            return vmmlaq_s32(acc, x, y);
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<uint32_t, A> mmla(batch<uint32_t, A> const& acc, batch<uint8_t, A> const& x, batch<uint8_t, A> const& y, requires_arch<i8mm<neon64>>) noexcept
+        {
+            return vmmlaq_u32(acc, x, y);
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> mmla(batch<int32_t, A> const& acc, batch<uint8_t, A> const& x, batch<int8_t, A> const& y, requires_arch<i8mm<neon64>>) noexcept
+        {
+            return vusmmlaq_s32(acc, x, y);
+        }
+    }
+}
+
 #endif
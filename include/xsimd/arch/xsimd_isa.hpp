@@ -13,6 +13,8 @@
 #define XSIMD_ISA_HPP
 
 #include "../config/xsimd_arch.hpp"
+#include "../types/xsimd_bfloat16.hpp"
+#include "../types/xsimd_float16.hpp"
 
 #include "./xsimd_generic_fwd.hpp"
 
@@ -72,6 +74,10 @@
 #include "./xsimd_avx512f.hpp"
 #endif
 
+#if XSIMD_WITH_AVX512CD
+#include "./xsimd_avx512cd.hpp"
+#endif
+
 #if XSIMD_WITH_AVX512BW
 #include "./xsimd_avx512bw.hpp"
 #endif
@@ -100,6 +106,10 @@
 #include "./xsimd_avx512vnni_avx512vbmi.hpp"
 #endif
 
+#if XSIMD_WITH_AVX512BF16
+#include "./xsimd_avx512bf16.hpp"
+#endif
+
 #if XSIMD_WITH_NEON
 #include "./xsimd_neon.hpp"
 #endif
@@ -13,6 +13,7 @@
 #define XSIMD_NEON_HPP
 
 #include <algorithm>
+#include <array>
 #include <complex>
 #include <tuple>
 #include <type_traits>
@@ -572,6 +573,18 @@ namespace xsimd
             return vld1q_f32(src);
         }
 
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_unaligned(bfloat16 const* src, convert<float>, requires_arch<neon>) noexcept
+        {
+            return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(reinterpret_cast<uint16_t const*>(src)), 16));
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_aligned(bfloat16 const* src, convert<float>, requires_arch<neon>) noexcept
+        {
+            return load_unaligned<A>(src, convert<float> {}, A {});
+        }
+
         /*********
          * store *
          *********/
@@ -636,6 +649,32 @@ namespace xsimd
             store_aligned<A>(dst, src, A {});
         }
 
+        template <class A>
+        XSIMD_INLINE void store_unaligned(bfloat16* dst, batch<float, A> const& src, requires_arch<neon>) noexcept
+        {
+            vst1_u16(reinterpret_cast<uint16_t*>(dst), vshrn_n_u32(detail::float_to_bfloat16(src), 16));
+        }
+
+        template <class A>
+        XSIMD_INLINE void store_aligned(bfloat16* dst, batch<float, A> const& src, requires_arch<neon>) noexcept
+        {
+            store_unaligned<A>(dst, src, A {});
+        }
+
+        template <class A>
+        XSIMD_INLINE std::array<batch<float, A>, 2> to_float(batch<bfloat16, A> const& src, requires_arch<neon>) noexcept
+        {
+            uint16x8_t bits = src;
+            return { batch<float, A>(vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(bits), 16))),
+                     batch<float, A>(vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(bits), 16))) };
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<bfloat16, A> to_bfloat16(batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<neon>) noexcept
+        {
+            return vcombine_u16(vshrn_n_u32(detail::float_to_bfloat16(lo), 16), vshrn_n_u32(detail::float_to_bfloat16(hi), 16));
+        }
+
         /****************
          * load_complex *
          ****************/
@@ -677,6 +716,73 @@ namespace xsimd
             store_complex_aligned(dst, src, A {});
         }
 
+        /****************************************
+         * load_interleaved / store_interleaved *
+         ****************************************/
+
+#define WRAP_INTERLEAVED(SUFFIX, TYPE)                                                                                          \
+    template <class A>                                                                                                          \
+    XSIMD_INLINE void load_interleaved(TYPE const* mem, std::array<batch<TYPE, A>, 2>& channels, requires_arch<neon>) noexcept  \
+    {                                                                                                                           \
+        auto tmp = vld2q_##SUFFIX(mem);                                                                                         \
+        channels[0] = tmp.val[0];                                                                                               \
+        channels[1] = tmp.val[1];                                                                                               \
+    }                                                                                                                           \
+    template <class A>                                                                                                          \
+    XSIMD_INLINE void load_interleaved(TYPE const* mem, std::array<batch<TYPE, A>, 3>& channels, requires_arch<neon>) noexcept  \
+    {                                                                                                                           \
+        auto tmp = vld3q_##SUFFIX(mem);                                                                                         \
+        channels[0] = tmp.val[0];                                                                                               \
+        channels[1] = tmp.val[1];                                                                                               \
+        channels[2] = tmp.val[2];                                                                                               \
+    }                                                                                                                           \
+    template <class A>                                                                                                          \
+    XSIMD_INLINE void load_interleaved(TYPE const* mem, std::array<batch<TYPE, A>, 4>& channels, requires_arch<neon>) noexcept  \
+    {                                                                                                                           \
+        auto tmp = vld4q_##SUFFIX(mem);                                                                                         \
+        channels[0] = tmp.val[0];                                                                                               \
+        channels[1] = tmp.val[1];                                                                                               \
+        channels[2] = tmp.val[2];                                                                                               \
+        channels[3] = tmp.val[3];                                                                                               \
+    }                                                                                                                           \
+    template <class A>                                                                                                          \
+    XSIMD_INLINE void store_interleaved(TYPE* mem, std::array<batch<TYPE, A>, 2> const& channels, requires_arch<neon>) noexcept \
+    {                                                                                                                           \
+        decltype(vld2q_##SUFFIX(mem)) tmp;                                                                                      \
+        tmp.val[0] = channels[0];                                                                                               \
+        tmp.val[1] = channels[1];                                                                                               \
+        vst2q_##SUFFIX(mem, tmp);                                                                                               \
+    }                                                                                                                           \
+    template <class A>                                                                                                          \
+    XSIMD_INLINE void store_interleaved(TYPE* mem, std::array<batch<TYPE, A>, 3> const& channels, requires_arch<neon>) noexcept \
+    {                                                                                                                           \
+        decltype(vld3q_##SUFFIX(mem)) tmp;                                                                                      \
+        tmp.val[0] = channels[0];                                                                                               \
+        tmp.val[1] = channels[1];                                                                                               \
+        tmp.val[2] = channels[2];                                                                                               \
+        vst3q_##SUFFIX(mem, tmp);                                                                                               \
+    }                                                                                                                           \
+    template <class A>                                                                                                          \
+    XSIMD_INLINE void store_interleaved(TYPE* mem, std::array<batch<TYPE, A>, 4> const& channels, requires_arch<neon>) noexcept \
+    {                                                                                                                           \
+        decltype(vld4q_##SUFFIX(mem)) tmp;                                                                                      \
+        tmp.val[0] = channels[0];                                                                                               \
+        tmp.val[1] = channels[1];                                                                                               \
+        tmp.val[2] = channels[2];                                                                                               \
+        tmp.val[3] = channels[3];                                                                                               \
+        vst4q_##SUFFIX(mem, tmp);                                                                                               \
+    }
+
+        WRAP_INTERLEAVED(u8, uint8_t)
+        WRAP_INTERLEAVED(s8, int8_t)
+        WRAP_INTERLEAVED(u16, uint16_t)
+        WRAP_INTERLEAVED(s16, int16_t)
+        WRAP_INTERLEAVED(u32, uint32_t)
+        WRAP_INTERLEAVED(s32, int32_t)
+        WRAP_INTERLEAVED(f32, float)
+
+#undef WRAP_INTERLEAVED
+
         /*******
          * neg *
          *******/
@@ -12,6 +12,7 @@
 #ifndef XSIMD_NEON64_HPP
 #define XSIMD_NEON64_HPP
 
+#include <array>
 #include <complex>
 #include <cstddef>
 #include <tuple>
@@ -154,6 +155,18 @@ namespace xsimd
         }
 #undef xsimd_aligned_load
 
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_unaligned(float16 const* src, convert<float>, requires_arch<neon64>) noexcept
+        {
+            return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(reinterpret_cast<uint16_t const*>(src))));
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_aligned(float16 const* src, convert<float>, requires_arch<neon64>) noexcept
+        {
+            return load_unaligned<A>(src, convert<float> {}, A {});
+        }
+
         /*********
          * store *
          *********/
@@ -170,6 +183,45 @@ namespace xsimd
             return store_aligned<A>(dst, src, A {});
         }
 
+        template <class A>
+        XSIMD_INLINE void store_unaligned(float16* dst, batch<float, A> const& src, requires_arch<neon64>) noexcept
+        {
+            vst1_u16(reinterpret_cast<uint16_t*>(dst), vreinterpret_u16_f16(vcvt_f16_f32(src)));
+        }
+
+        template <class A>
+        XSIMD_INLINE void store_aligned(float16* dst, batch<float, A> const& src, requires_arch<neon64>) noexcept
+        {
+            store_unaligned<A>(dst, src, A {});
+        }
+
+        template <class A>
+        XSIMD_INLINE std::array<batch<float, A>, 2> to_float(batch<float16, A> const& src, requires_arch<neon64>) noexcept
+        {
+            uint16x8_t bits = src;
+            return { batch<float, A>(vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(bits)))),
+                     batch<float, A>(vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(bits)))) };
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<float16, A> to_float16(batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<neon64>) noexcept
+        {
+            return vcombine_u16(vreinterpret_u16_f16(vcvt_f16_f32(lo)), vreinterpret_u16_f16(vcvt_f16_f32(hi)));
+        }
+
+#if defined(__GNUC__) || defined(__clang__)
+        // there is no intrinsic for stnp, the pair store with a non-temporal hint
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value, void>::type>
+        XSIMD_INLINE void store_stream(T* dst, batch<T, A> const& src, requires_arch<neon64>) noexcept
+        {
+            uint64x2_t bits = bitwise_cast<uint64_t>(src);
+            __asm__ __volatile__("stnp %d[lo], %d[hi], [%[dst]]"
+                                 :
+                                 : [lo] "w"(vget_low_u64(bits)), [hi] "w"(vget_high_u64(bits)), [dst] "r"(dst)
+                                 : "memory");
+        }
+#endif
+
         /****************
          * load_complex *
          ****************/
@@ -211,6 +263,69 @@ namespace xsimd
             store_complex_aligned(dst, src, A {});
         }
 
+        /****************************************
+         * load_interleaved / store_interleaved *
+         ****************************************/
+
+#define WRAP_INTERLEAVED(SUFFIX, TYPE)                                                                                            \
+    template <class A>                                                                                                            \
+    XSIMD_INLINE void load_interleaved(TYPE const* mem, std::array<batch<TYPE, A>, 2>& channels, requires_arch<neon64>) noexcept  \
+    {                                                                                                                             \
+        auto tmp = vld2q_##SUFFIX(mem);                                                                                           \
+        channels[0] = tmp.val[0];                                                                                                 \
+        channels[1] = tmp.val[1];                                                                                                 \
+    }                                                                                                                             \
+    template <class A>                                                                                                            \
+    XSIMD_INLINE void load_interleaved(TYPE const* mem, std::array<batch<TYPE, A>, 3>& channels, requires_arch<neon64>) noexcept  \
+    {                                                                                                                             \
+        auto tmp = vld3q_##SUFFIX(mem);                                                                                           \
+        channels[0] = tmp.val[0];                                                                                                 \
+        channels[1] = tmp.val[1];                                                                                                 \
+        channels[2] = tmp.val[2];                                                                                                 \
+    }                                                                                                                             \
+    template <class A>                                                                                                            \
+    XSIMD_INLINE void load_interleaved(TYPE const* mem, std::array<batch<TYPE, A>, 4>& channels, requires_arch<neon64>) noexcept  \
+    {                                                                                                                             \
+        auto tmp = vld4q_##SUFFIX(mem);                                                                                           \
+        channels[0] = tmp.val[0];                                                                                                 \
+        channels[1] = tmp.val[1];                                                                                                 \
+        channels[2] = tmp.val[2];                                                                                                 \
+        channels[3] = tmp.val[3];                                                                                                 \
+    }                                                                                                                             \
+    template <class A>                                                                                                            \
+    XSIMD_INLINE void store_interleaved(TYPE* mem, std::array<batch<TYPE, A>, 2> const& channels, requires_arch<neon64>) noexcept \
+    {                                                                                                                             \
+        decltype(vld2q_##SUFFIX(mem)) tmp;                                                                                        \
+        tmp.val[0] = channels[0];                                                                                                 \
+        tmp.val[1] = channels[1];                                                                                                 \
+        vst2q_##SUFFIX(mem, tmp);                                                                                                 \
+    }                                                                                                                             \
+    template <class A>                                                                                                            \
+    XSIMD_INLINE void store_interleaved(TYPE* mem, std::array<batch<TYPE, A>, 3> const& channels, requires_arch<neon64>) noexcept \
+    {                                                                                                                             \
+        decltype(vld3q_##SUFFIX(mem)) tmp;                                                                                        \
+        tmp.val[0] = channels[0];                                                                                                 \
+        tmp.val[1] = channels[1];                                                                                                 \
+        tmp.val[2] = channels[2];                                                                                                 \
+        vst3q_##SUFFIX(mem, tmp);                                                                                                 \
+    }                                                                                                                             \
+    template <class A>                                                                                                            \
+    XSIMD_INLINE void store_interleaved(TYPE* mem, std::array<batch<TYPE, A>, 4> const& channels, requires_arch<neon64>) noexcept \
+    {                                                                                                                             \
+        decltype(vld4q_##SUFFIX(mem)) tmp;                                                                                        \
+        tmp.val[0] = channels[0];                                                                                                 \
+        tmp.val[1] = channels[1];                                                                                                 \
+        tmp.val[2] = channels[2];                                                                                                 \
+        tmp.val[3] = channels[3];                                                                                                 \
+        vst4q_##SUFFIX(mem, tmp);                                                                                                 \
+    }
+
+        WRAP_INTERLEAVED(u64, uint64_t)
+        WRAP_INTERLEAVED(s64, int64_t)
+        WRAP_INTERLEAVED(f64, double)
+
+#undef WRAP_INTERLEAVED
+
         /*******
          * neg *
          *******/
@@ -306,6 +421,34 @@ namespace xsimd
             return vdivq_f64(lhs, rhs);
         }
 
+        /******************
+         * dot_accumulate *
+         ******************/
+
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<int16_t, A> const& x, batch<int16_t, A> const& y, requires_arch<neon64>) noexcept
+        {
+            int16x8_t xr = x;
+            int16x8_t yr = y;
+            int32x4_t lo = vmull_s16(vget_low_s16(xr), vget_low_s16(yr));
+            int32x4_t hi = vmull_high_s16(xr, yr);
+            return vaddq_s32(acc, vpaddq_s32(lo, hi));
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<uint8_t, A> const& x, batch<int8_t, A> const& y, requires_arch<neon64>) noexcept
+        {
+            uint8x16_t xr = x;
+            int8x16_t yr = y;
+            int16x8_t x_lo = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(xr)));
+            int16x8_t x_hi = vreinterpretq_s16_u16(vmovl_high_u8(xr));
+            int16x8_t y_lo = vmovl_s8(vget_low_s8(yr));
+            int16x8_t y_hi = vmovl_high_s8(yr);
+            int32x4_t p_lo = vpaddq_s32(vmull_s16(vget_low_s16(x_lo), vget_low_s16(y_lo)), vmull_high_s16(x_lo, y_lo));
+            int32x4_t p_hi = vpaddq_s32(vmull_s16(vget_low_s16(x_hi), vget_low_s16(y_hi)), vmull_high_s16(x_hi, y_hi));
+            return vaddq_s32(acc, vpaddq_s32(p_lo, p_hi));
+        }
+
         /******
          * eq *
          ******/
@@ -1248,6 +1391,25 @@ namespace xsimd
 
     namespace kernel
     {
+        /**********
+         * lookup *
+         **********/
+        template <class A>
+        XSIMD_INLINE batch<uint8_t, A> lookup(batch<uint8_t, A> const& table_lo, batch<uint8_t, A> const& table_hi, batch<uint8_t, A> const& idx,
+                                              requires_arch<neon64>) noexcept
+        {
+            uint8x16x2_t table = { { table_lo, table_hi } };
+            return vqtbl2q_u8(table, vandq_u8(idx, vdupq_n_u8(31)));
+        }
+
+        template <class A>
+        XSIMD_INLINE batch<int8_t, A> lookup(batch<int8_t, A> const& table_lo, batch<int8_t, A> const& table_hi, batch<uint8_t, A> const& idx,
+                                             requires_arch<neon64>) noexcept
+        {
+            int8x16x2_t table = { { table_lo, table_hi } };
+            return vqtbl2q_s8(table, vandq_u8(idx, vdupq_n_u8(31)));
+        }
+
         /*********************
          * swizzle (dynamic) *
          *********************/
@@ -12,6 +12,7 @@
 #ifndef XSIMD_SSE2_HPP
 #define XSIMD_SSE2_HPP
 
+#include <array>
 #include <complex>
 #include <limits>
 #include <type_traits>
@@ -574,6 +575,13 @@ namespace xsimd
             return _mm_div_pd(self, other);
         }
 
+        // dot_accumulate
+        template <class A>
+        XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<int16_t, A> const& x, batch<int16_t, A> const& y, requires_arch<sse2>) noexcept
+        {
+            return _mm_add_epi32(acc, _mm_madd_epi16(x, y));
+        }
+
         // fast_cast
         namespace detail
         {
@@ -908,6 +916,28 @@ namespace xsimd
         {
             return _mm_loadu_pd(mem);
         }
+#if XSIMD_WITH_F16C
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_unaligned(float16 const* mem, convert<float>, requires_arch<sse2>) noexcept
+        {
+            return _mm_cvtph_ps(_mm_loadl_epi64((__m128i const*)mem));
+        }
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_aligned(float16 const* mem, convert<float>, requires_arch<sse2>) noexcept
+        {
+            return load_unaligned<A>(mem, convert<float> {}, sse2 {});
+        }
+#endif
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_unaligned(bfloat16 const* mem, convert<float>, requires_arch<sse2>) noexcept
+        {
+            return _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), _mm_loadl_epi64((__m128i const*)mem)));
+        }
+        template <class A>
+        XSIMD_INLINE batch<float, A> load_aligned(bfloat16 const* mem, convert<float>, requires_arch<sse2>) noexcept
+        {
+            return load_unaligned<A>(mem, convert<float> {}, sse2 {});
+        }
 
         // load_complex
         namespace detail
@@ -925,6 +955,121 @@ namespace xsimd
             }
         }
 
+        // load_interleaved
+        namespace detail
+        {
+            // Lane l of the batch I of N interleaved (Store) or deinterleaved
+            // (!Store) batches is taken from lane index(l) of batch J of the
+            // other layout, when select(l) holds.
+            template <class T, bool Store, std::size_t N, std::size_t I, std::size_t J>
+            struct interleaved_index
+            {
+                static constexpr T get(std::size_t l, std::size_t size) noexcept
+                {
+                    return static_cast<T>(Store ? (I * size + l) / N : (l * N + I) % size);
+                }
+            };
+
+            template <bool Store, std::size_t N, std::size_t I, std::size_t J>
+            struct interleaved_select
+            {
+                static constexpr bool get(std::size_t l, std::size_t size) noexcept
+                {
+                    return (Store ? (I * size + l) % N : (l * N + I) / size) == J;
+                }
+            };
+        }
+
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value, void>::type>
+        XSIMD_INLINE void load_interleaved(T const* mem, std::array<batch<T, A>, 2>& channels, requires_arch<sse2>) noexcept
+        {
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 1)
+            {
+                // narrow the even and the odd elements of each 16 bit word
+                __m128i a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(mem));
+                __m128i b = _mm_loadu_si128(reinterpret_cast<__m128i const*>(mem) + 1);
+                __m128i low = _mm_set1_epi16(0x00FF);
+                channels[0] = bitwise_cast<T>(batch<uint8_t, A>(_mm_packus_epi16(_mm_and_si128(a, low), _mm_and_si128(b, low))));
+                channels[1] = bitwise_cast<T>(batch<uint8_t, A>(_mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8))));
+            }
+            else XSIMD_IF_CONSTEXPR(sizeof(T) == 2)
+            {
+                // sign extended halves of each 32 bit word pack without saturation
+                __m128i a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(mem));
+                __m128i b = _mm_loadu_si128(reinterpret_cast<__m128i const*>(mem) + 1);
+                channels[0] = bitwise_cast<T>(batch<uint16_t, A>(_mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16))));
+                channels[1] = bitwise_cast<T>(batch<uint16_t, A>(_mm_packs_epi32(_mm_srai_epi32(a, 16), _mm_srai_epi32(b, 16))));
+            }
+            else XSIMD_IF_CONSTEXPR(sizeof(T) == 4)
+            {
+                __m128 a = _mm_loadu_ps(reinterpret_cast<float const*>(mem));
+                __m128 b = _mm_loadu_ps(reinterpret_cast<float const*>(mem) + 4);
+                channels[0] = bitwise_cast<T>(batch<float, A>(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))));
+                channels[1] = bitwise_cast<T>(batch<float, A>(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))));
+            }
+            else
+            {
+                __m128d a = _mm_loadu_pd(reinterpret_cast<double const*>(mem));
+                __m128d b = _mm_loadu_pd(reinterpret_cast<double const*>(mem) + 2);
+                channels[0] = bitwise_cast<T>(batch<double, A>(_mm_unpacklo_pd(a, b)));
+                channels[1] = bitwise_cast<T>(batch<double, A>(_mm_unpackhi_pd(a, b)));
+            }
+        }
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE void load_interleaved(T const* mem, std::array<batch<T, A>, 3>& channels, requires_arch<sse2>) noexcept
+        {
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 4)
+            {
+                // a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+                __m128 a = _mm_loadu_ps(reinterpret_cast<float const*>(mem));
+                __m128 b = _mm_loadu_ps(reinterpret_cast<float const*>(mem) + 4);
+                __m128 c = _mm_loadu_ps(reinterpret_cast<float const*>(mem) + 8);
+                __m128 x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+                __m128 y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+                __m128 z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+                channels[0] = bitwise_cast<T>(batch<float, A>(x));
+                channels[1] = bitwise_cast<T>(batch<float, A>(y));
+                channels[2] = bitwise_cast<T>(batch<float, A>(z));
+            }
+            else
+            {
+                // a = x0 y0, b = z0 x1, c = y1 z1
+                __m128d a = _mm_loadu_pd(reinterpret_cast<double const*>(mem));
+                __m128d b = _mm_loadu_pd(reinterpret_cast<double const*>(mem) + 2);
+                __m128d c = _mm_loadu_pd(reinterpret_cast<double const*>(mem) + 4);
+                channels[0] = bitwise_cast<T>(batch<double, A>(_mm_shuffle_pd(a, b, _MM_SHUFFLE2(1, 0))));
+                channels[1] = bitwise_cast<T>(batch<double, A>(_mm_shuffle_pd(a, c, _MM_SHUFFLE2(0, 1))));
+                channels[2] = bitwise_cast<T>(batch<double, A>(_mm_shuffle_pd(b, c, _MM_SHUFFLE2(1, 0))));
+            }
+        }
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE void load_interleaved(T const* mem, std::array<batch<T, A>, 4>& channels, requires_arch<sse2>) noexcept
+        {
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 4)
+            {
+                __m128 a = _mm_loadu_ps(reinterpret_cast<float const*>(mem));
+                __m128 b = _mm_loadu_ps(reinterpret_cast<float const*>(mem) + 4);
+                __m128 c = _mm_loadu_ps(reinterpret_cast<float const*>(mem) + 8);
+                __m128 d = _mm_loadu_ps(reinterpret_cast<float const*>(mem) + 12);
+                _MM_TRANSPOSE4_PS(a, b, c, d);
+                channels[0] = bitwise_cast<T>(batch<float, A>(a));
+                channels[1] = bitwise_cast<T>(batch<float, A>(b));
+                channels[2] = bitwise_cast<T>(batch<float, A>(c));
+                channels[3] = bitwise_cast<T>(batch<float, A>(d));
+            }
+            else
+            {
+                __m128d a = _mm_loadu_pd(reinterpret_cast<double const*>(mem));
+                __m128d b = _mm_loadu_pd(reinterpret_cast<double const*>(mem) + 2);
+                __m128d c = _mm_loadu_pd(reinterpret_cast<double const*>(mem) + 4);
+                __m128d d = _mm_loadu_pd(reinterpret_cast<double const*>(mem) + 6);
+                channels[0] = bitwise_cast<T>(batch<double, A>(_mm_unpacklo_pd(a, c)));
+                channels[1] = bitwise_cast<T>(batch<double, A>(_mm_unpackhi_pd(a, c)));
+                channels[2] = bitwise_cast<T>(batch<double, A>(_mm_unpacklo_pd(b, d)));
+                channels[3] = bitwise_cast<T>(batch<double, A>(_mm_unpackhi_pd(b, d)));
+            }
+        }
+
         // le
         template <class A>
         XSIMD_INLINE batch_bool<float, A> le(batch<float, A> const& self, batch<float, A> const& other, requires_arch<sse2>) noexcept
@@ -1199,6 +1344,15 @@ namespace xsimd
             return _mm_xor_pd(self, other);
         }
 
+        // prefetch
+        template <class A, int Locality>
+        XSIMD_INLINE void prefetch(void const* ptr, requires_arch<sse2>) noexcept
+        {
+            _mm_prefetch(reinterpret_cast<char const*>(ptr), Locality == 3 ? _MM_HINT_T0 : Locality == 2 ? _MM_HINT_T1
+                                                                : Locality == 1                            ? _MM_HINT_T2
+                                                                                                           : _MM_HINT_NTA);
+        }
+
         // reciprocal
         template <class A>
         XSIMD_INLINE batch<float, A> reciprocal(batch<float, A> const& self,
@@ -1539,6 +1693,104 @@ namespace xsimd
             return _mm_store_pd(mem, self);
         }
 
+        // store_interleaved
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value, void>::type>
+        XSIMD_INLINE void store_interleaved(T* mem, std::array<batch<T, A>, 2> const& channels, requires_arch<sse2>) noexcept
+        {
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 1)
+            {
+                __m128i x = bitwise_cast<uint8_t>(channels[0]), y = bitwise_cast<uint8_t>(channels[1]);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(mem), _mm_unpacklo_epi8(x, y));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(mem) + 1, _mm_unpackhi_epi8(x, y));
+            }
+            else XSIMD_IF_CONSTEXPR(sizeof(T) == 2)
+            {
+                __m128i x = bitwise_cast<uint16_t>(channels[0]), y = bitwise_cast<uint16_t>(channels[1]);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(mem), _mm_unpacklo_epi16(x, y));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(mem) + 1, _mm_unpackhi_epi16(x, y));
+            }
+            else XSIMD_IF_CONSTEXPR(sizeof(T) == 4)
+            {
+                __m128 x = bitwise_cast<float>(channels[0]), y = bitwise_cast<float>(channels[1]);
+                _mm_storeu_ps(reinterpret_cast<float*>(mem), _mm_unpacklo_ps(x, y));
+                _mm_storeu_ps(reinterpret_cast<float*>(mem) + 4, _mm_unpackhi_ps(x, y));
+            }
+            else
+            {
+                __m128d x = bitwise_cast<double>(channels[0]), y = bitwise_cast<double>(channels[1]);
+                _mm_storeu_pd(reinterpret_cast<double*>(mem), _mm_unpacklo_pd(x, y));
+                _mm_storeu_pd(reinterpret_cast<double*>(mem) + 2, _mm_unpackhi_pd(x, y));
+            }
+        }
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE void store_interleaved(T* mem, std::array<batch<T, A>, 3> const& channels, requires_arch<sse2>) noexcept
+        {
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 4)
+            {
+                __m128 x = bitwise_cast<float>(channels[0]), y = bitwise_cast<float>(channels[1]), z = bitwise_cast<float>(channels[2]);
+                __m128 a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+                __m128 b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+                __m128 c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+                _mm_storeu_ps(reinterpret_cast<float*>(mem), a);
+                _mm_storeu_ps(reinterpret_cast<float*>(mem) + 4, b);
+                _mm_storeu_ps(reinterpret_cast<float*>(mem) + 8, c);
+            }
+            else
+            {
+                __m128d x = bitwise_cast<double>(channels[0]), y = bitwise_cast<double>(channels[1]), z = bitwise_cast<double>(channels[2]);
+                _mm_storeu_pd(reinterpret_cast<double*>(mem), _mm_shuffle_pd(x, y, _MM_SHUFFLE2(0, 0)));
+                _mm_storeu_pd(reinterpret_cast<double*>(mem) + 2, _mm_shuffle_pd(z, x, _MM_SHUFFLE2(1, 0)));
+                _mm_storeu_pd(reinterpret_cast<double*>(mem) + 4, _mm_shuffle_pd(y, z, _MM_SHUFFLE2(1, 1)));
+            }
+        }
+        template <class A, class T, class = typename std::enable_if<std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8), void>::type>
+        XSIMD_INLINE void store_interleaved(T* mem, std::array<batch<T, A>, 4> const& channels, requires_arch<sse2>) noexcept
+        {
+            XSIMD_IF_CONSTEXPR(sizeof(T) == 4)
+            {
+                __m128 a = bitwise_cast<float>(channels[0]), b = bitwise_cast<float>(channels[1]);
+                __m128 c = bitwise_cast<float>(channels[2]), d = bitwise_cast<float>(channels[3]);
+                _MM_TRANSPOSE4_PS(a, b, c, d);
+                _mm_storeu_ps(reinterpret_cast<float*>(mem), a);
+                _mm_storeu_ps(reinterpret_cast<float*>(mem) + 4, b);
+                _mm_storeu_ps(reinterpret_cast<float*>(mem) + 8, c);
+                _mm_storeu_ps(reinterpret_cast<float*>(mem) + 12, d);
+            }
+            else
+            {
+                __m128d x = bitwise_cast<double>(channels[0]), y = bitwise_cast<double>(channels[1]);
+                __m128d z = bitwise_cast<double>(channels[2]), w = bitwise_cast<double>(channels[3]);
+                _mm_storeu_pd(reinterpret_cast<double*>(mem), _mm_unpacklo_pd(x, y));
+                _mm_storeu_pd(reinterpret_cast<double*>(mem) + 2, _mm_unpacklo_pd(z, w));
+                _mm_storeu_pd(reinterpret_cast<double*>(mem) + 4, _mm_unpackhi_pd(x, y));
+                _mm_storeu_pd(reinterpret_cast<double*>(mem) + 6, _mm_unpackhi_pd(z, w));
+            }
+        }
+
+        // store_stream
+        template <class A>
+        XSIMD_INLINE void store_stream(float* mem, batch<float, A> const& self, requires_arch<sse2>) noexcept
+        {
+            _mm_stream_ps(mem, self);
+        }
+        template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
+        XSIMD_INLINE void store_stream(T* mem, batch<T, A> const& self, requires_arch<sse2>) noexcept
+        {
+            _mm_stream_si128((__m128i*)mem, self);
+        }
+        template <class A>
+        XSIMD_INLINE void store_stream(double* mem, batch<double, A> const& self, requires_arch<sse2>) noexcept
+        {
+            _mm_stream_pd(mem, self);
+        }
+
+        // stream_fence
+        template <class A>
+        XSIMD_INLINE void stream_fence(requires_arch<sse2>) noexcept
+        {
+            _mm_sfence();
+        }
+
         // store_unaligned
         template <class A>
         XSIMD_INLINE void store_unaligned(float* mem, batch<float, A> const& self, requires_arch<sse2>) noexcept
@@ -1560,6 +1812,50 @@ namespace xsimd
         {
             return _mm_storeu_pd(mem, self);
         }
+#if XSIMD_WITH_F16C
+        template <class A>
+        XSIMD_INLINE void store_unaligned(float16* mem, batch<float, A> const& self, requires_arch<sse2>) noexcept
+        {
+            _mm_storel_epi64((__m128i*)mem, _mm_cvtps_ph(self, _MM_FROUND_TO_NEAREST_INT));
+        }
+        template <class A>
+        XSIMD_INLINE void store_aligned(float16* mem, batch<float, A> const& self, requires_arch<sse2>) noexcept
+        {
+            store_unaligned<A>(mem, self, sse2 {});
+        }
+        template <class A>
+        XSIMD_INLINE std::array<batch<float, A>, 2> to_float(batch<float16, A> const& self, requires_arch<sse2>) noexcept
+        {
+            return { _mm_cvtph_ps(self), _mm_cvtph_ps(_mm_unpackhi_epi64(self, self)) };
+        }
+        template <class A>
+        XSIMD_INLINE batch<float16, A> to_float16(batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<sse2>) noexcept
+        {
+            return _mm_unpacklo_epi64(_mm_cvtps_ph(lo, _MM_FROUND_TO_NEAREST_INT), _mm_cvtps_ph(hi, _MM_FROUND_TO_NEAREST_INT));
+        }
+#endif
+        template <class A>
+        XSIMD_INLINE void store_unaligned(bfloat16* mem, batch<float, A> const& self, requires_arch<sse2>) noexcept
+        {
+            // the arithmetic shift keeps the packed values in int16 range
+            __m128i hi = _mm_srai_epi32(detail::float_to_bfloat16(self), 16);
+            _mm_storel_epi64((__m128i*)mem, _mm_packs_epi32(hi, hi));
+        }
+        template <class A>
+        XSIMD_INLINE void store_aligned(bfloat16* mem, batch<float, A> const& self, requires_arch<sse2>) noexcept
+        {
+            store_unaligned<A>(mem, self, sse2 {});
+        }
+        template <class A>
+        XSIMD_INLINE std::array<batch<float, A>, 2> to_float(batch<bfloat16, A> const& self, requires_arch<sse2>) noexcept
+        {
+            return { _mm_castsi128_ps(_mm_unpacklo_epi16(_mm_setzero_si128(), self)), _mm_castsi128_ps(_mm_unpackhi_epi16(_mm_setzero_si128(), self)) };
+        }
+        template <class A>
+        XSIMD_INLINE batch<bfloat16, A> to_bfloat16(batch<float, A> const& lo, batch<float, A> const& hi, requires_arch<sse2>) noexcept
+        {
+            return _mm_packs_epi32(_mm_srai_epi32(detail::float_to_bfloat16(lo), 16), _mm_srai_epi32(detail::float_to_bfloat16(hi), 16));
+        }
 
         // sub
         template <class A>
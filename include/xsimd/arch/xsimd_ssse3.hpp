@@ -12,7 +12,9 @@
 #ifndef XSIMD_SSSE3_HPP
 #define XSIMD_SSSE3_HPP
 
+#include <array>
 #include <cstddef>
+#include <initializer_list>
 #include <type_traits>
 
 #include "../types/xsimd_ssse3_register.hpp"
@@ -82,6 +84,46 @@ namespace xsimd
             return detail::extract_pair(self, other, i, ::xsimd::detail::make_index_sequence<size>());
         }
 
+        // load_interleaved
+        namespace detail
+        {
+            // pshufb control selecting the bytes of the elements of batch J
+            // that go to batch I, zeroing the others
+            template <class T, bool Store, std::size_t N, std::size_t I, std::size_t J>
+            struct interleaved_byte_index
+            {
+                static constexpr uint8_t get(std::size_t b, std::size_t bytes) noexcept
+                {
+                    return interleaved_select<Store, N, I, J>::get(b / sizeof(T), bytes / sizeof(T))
+                        ? static_cast<uint8_t>(interleaved_index<std::size_t, Store, N, I, J>::get(b / sizeof(T), bytes / sizeof(T)) * sizeof(T) + b % sizeof(T))
+                        : uint8_t(0x80);
+                }
+            };
+
+            template <class T, bool Store, std::size_t N, std::size_t I, class A, std::size_t... Js>
+            XSIMD_INLINE batch<T, A> interleaved_shuffle(std::array<batch<T, A>, N> const& in, ::xsimd::detail::index_sequence<Js...>) noexcept
+            {
+                __m128i res = _mm_setzero_si128();
+                (void)std::initializer_list<bool> { (res = _mm_or_si128(res, _mm_shuffle_epi8(in[Js], make_batch_constant<uint8_t, A, interleaved_byte_index<T, Store, N, I, Js>>().as_batch())), true)... };
+                return res;
+            }
+
+            template <bool Store, class A, class T, std::size_t N, std::size_t... Is>
+            XSIMD_INLINE void interleaved_shuffles(std::array<batch<T, A>, N> const& in, std::array<batch<T, A>, N>& out, ::xsimd::detail::index_sequence<Is...>) noexcept
+            {
+                (void)std::initializer_list<bool> { (out[Is] = interleaved_shuffle<T, Store, N, Is>(in, ::xsimd::detail::make_index_sequence<N>()), true)... };
+            }
+        }
+
+        template <class A, class T, std::size_t N, class = typename std::enable_if<std::is_integral<T>::value && sizeof(T) <= 2 && N != 2, void>::type>
+        XSIMD_INLINE void load_interleaved(T const* mem, std::array<batch<T, A>, N>& channels, requires_arch<ssse3>) noexcept
+        {
+            std::array<batch<T, A>, N> in;
+            for (std::size_t k = 0; k < N; ++k)
+                in[k] = batch<T, A>::load_unaligned(mem + k * batch<T, A>::size);
+            detail::interleaved_shuffles<false>(in, channels, ::xsimd::detail::make_index_sequence<N>());
+        }
+
         // reduce_add
         template <class A, class T, class = typename std::enable_if<std::is_integral<T>::value, void>::type>
         XSIMD_INLINE T reduce_add(batch<T, A> const& self, requires_arch<ssse3>) noexcept
@@ -117,6 +159,16 @@ namespace xsimd
             return bitwise_cast<int16_t>(rotate_right<N, A>(bitwise_cast<uint16_t>(self), ssse3 {}));
         }
 
+        // store_interleaved
+        template <class A, class T, std::size_t N, class = typename std::enable_if<std::is_integral<T>::value && sizeof(T) <= 2 && N != 2, void>::type>
+        XSIMD_INLINE void store_interleaved(T* mem, std::array<batch<T, A>, N> const& channels, requires_arch<ssse3>) noexcept
+        {
+            std::array<batch<T, A>, N> out;
+            detail::interleaved_shuffles<true>(channels, out, ::xsimd::detail::make_index_sequence<N>());
+            for (std::size_t k = 0; k < N; ++k)
+                out[k].store_unaligned(mem + k * batch<T, A>::size);
+        }
+
         // swizzle (dynamic mask)
         template <class A>
         XSIMD_INLINE batch<uint8_t, A> swizzle(batch<uint8_t, A> const& self, batch<uint8_t, A> mask, requires_arch<ssse3>) noexcept
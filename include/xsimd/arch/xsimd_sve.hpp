@@ -39,6 +39,15 @@ namespace xsimd
             template <class T>
             svbool_t sve_ptrue() noexcept { return sve_ptrue_impl(index<sizeof(T)> {}); }
 
+            // predicate of the n first lanes
+            XSIMD_INLINE svbool_t sve_whilelt_impl(uint64_t n, index<1>) noexcept { return svwhilelt_b8(uint64_t(0), n); }
+            XSIMD_INLINE svbool_t sve_whilelt_impl(uint64_t n, index<2>) noexcept { return svwhilelt_b16(uint64_t(0), n); }
+            XSIMD_INLINE svbool_t sve_whilelt_impl(uint64_t n, index<4>) noexcept { return svwhilelt_b32(uint64_t(0), n); }
+            XSIMD_INLINE svbool_t sve_whilelt_impl(uint64_t n, index<8>) noexcept { return svwhilelt_b64(uint64_t(0), n); }
+
+            template <class T>
+            XSIMD_INLINE svbool_t sve_whilelt(uint64_t n) noexcept { return sve_whilelt_impl(n, index<sizeof(T)> {}); }
+
             // count active lanes in a predicate
             XSIMD_INLINE uint64_t sve_pcount_impl(svbool_t p, index<1>) noexcept { return svcntp_b8(p, p); }
             XSIMD_INLINE uint64_t sve_pcount_impl(svbool_t p, index<2>) noexcept { return svcntp_b16(p, p); }
@@ -95,6 +104,20 @@ namespace xsimd
             return load_aligned<A>(src, convert<T>(), sve {});
         }
 
+        // load_masked
+        template <class A, class T, detail::sve_enable_all_t<T> = 0>
+        XSIMD_INLINE batch<T, A> load_masked(T const* src, batch_bool<T, A> const& mask, requires_arch<sve>) noexcept
+        {
+            return svld1(mask, reinterpret_cast<detail::sve_fix_char_t<T> const*>(src));
+        }
+
+        // load_partial
+        template <class A, class T, detail::sve_enable_all_t<T> = 0>
+        XSIMD_INLINE batch<T, A> load_partial(T const* src, std::size_t n, requires_arch<sve>) noexcept
+        {
+            return svld1(detail::sve_whilelt<T>(n), reinterpret_cast<detail::sve_fix_char_t<T> const*>(src));
+        }
+
         // load_complex
         template <class A, class T, detail::sve_enable_floating_point_t<T> = 0>
         XSIMD_INLINE batch<std::complex<T>, A> load_complex_aligned(std::complex<T> const* mem, convert<std::complex<T>>, requires_arch<sve>) noexcept
@@ -128,6 +151,20 @@ namespace xsimd
             store_aligned<A>(dst, src, sve {});
         }
 
+        // store_masked
+        template <class A, class T, detail::sve_enable_all_t<T> = 0>
+        XSIMD_INLINE void store_masked(T* dst, batch<T, A> const& src, batch_bool<T, A> const& mask, requires_arch<sve>) noexcept
+        {
+            svst1(mask, reinterpret_cast<detail::sve_fix_char_t<T>*>(dst), src);
+        }
+
+        // store_partial
+        template <class A, class T, detail::sve_enable_all_t<T> = 0>
+        XSIMD_INLINE void store_partial(T* dst, batch<T, A> const& src, std::size_t n, requires_arch<sve>) noexcept
+        {
+            svst1(detail::sve_whilelt<T>(n), reinterpret_cast<detail::sve_fix_char_t<T>*>(dst), src);
+        }
+
         // store_complex
         template <class A, class T, detail::sve_enable_floating_point_t<T> = 0>
         XSIMD_INLINE void store_complex_aligned(std::complex<T>* dst, batch<std::complex<T>, A> const& src, requires_arch<sve>) noexcept
@@ -12,6 +12,10 @@
 #ifndef XSIMD_ARCH_HPP
 #define XSIMD_ARCH_HPP
 
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
 #include <initializer_list>
 #include <type_traits>
 #include <utility>
@@ -159,10 +163,29 @@ namespace xsimd
             : join<typename Arch::template extend<Archs...>, Args...>
         {
         };
+
+        // Moves the Archs with registers wider than Bytes after the other
+        // ones, preserving the relative order within each group.
+        template <std::size_t Bytes, class Narrow, class Wide, class Archs>
+        struct narrow_first;
+
+        template <std::size_t Bytes, class Narrow, class... Wide>
+        struct narrow_first<Bytes, Narrow, arch_list<Wide...>, arch_list<>>
+        {
+            using type = typename Narrow::template extend<Wide...>;
+        };
+
+        template <std::size_t Bytes, class Narrow, class Wide, class Arch, class... Archs>
+        struct narrow_first<Bytes, Narrow, Wide, arch_list<Arch, Archs...>>
+            : std::conditional<(Arch::alignment() <= Bytes),
+                               narrow_first<Bytes, typename Narrow::template add<Arch>, Wide, arch_list<Archs...>>,
+                               narrow_first<Bytes, Narrow, typename Wide::template add<Arch>, arch_list<Archs...>>>::type
+        {
+        };
     } // namespace detail
 
     using all_x86_architectures = arch_list<
-        avx512vnni<avx512vbmi>, avx512vbmi, avx512ifma, avx512pf, avx512vnni<avx512bw>, avx512bw, avx512er, avx512dq, avx512cd, avx512f,
+        avx512bf16, avx512vnni<avx512vbmi>, avx512vbmi, avx512ifma, avx512pf, avx512vnni<avx512bw>, avx512bw, avx512er, avx512dq, avx512cd, avx512f,
         avxvnni, fma3<avx2>, avx2, fma3<avx>, avx, fma4, fma3<sse4_2>,
         sse4_2, sse4_1, /*sse4a,*/ ssse3, sse3, sse2>;
 
@@ -180,12 +203,196 @@ namespace xsimd
     using riscv_arch = typename detail::supported<all_riscv_architectures>::type::best;
     using best_arch = typename supported_architectures::best;
 
+    /**
+     * @ingroup architectures
+     *
+     * Dispatch policy favoring architectures whose registers are at most
+     * \c Bits wide: \c ArchList reordered so that these architectures come
+     * first, the wider ones being kept as a fallback. For instance
+     * \c dispatch<prefer_width<256>>(f) picks AVX2 over AVX-512 when both are
+     * available, which avoids the frequency drop of 512-bit instructions in
+     * short kernels interleaved with scalar code.
+     */
+    template <std::size_t Bits, class ArchList = supported_architectures>
+    using prefer_width = typename detail::narrow_first<Bits / 8, arch_list<>, arch_list<>, ArchList>::type;
+
 #ifdef XSIMD_DEFAULT_ARCH
     using default_arch = XSIMD_DEFAULT_ARCH;
 #else
     using default_arch = best_arch;
 #endif
 
+    namespace detail
+    {
+        XSIMD_INLINE bool arch_name_equals(char const* arch_name, char const* name, std::size_t length) noexcept
+        {
+            return std::strlen(arch_name) == length && std::strncmp(arch_name, name, length) == 0;
+        }
+
+        // Finds the rank of an architecture name in all_architectures, the
+        // best architecture coming first.
+        struct arch_rank_finder
+        {
+            char const* name;
+            std::size_t length;
+            int rank;
+            int found;
+
+            template <class Arch>
+            XSIMD_INLINE void operator()(Arch) noexcept
+            {
+                if (found < 0 && arch_name_equals(Arch::name(), name, length))
+                    found = rank;
+                ++rank;
+            }
+        };
+
+        XSIMD_INLINE int arch_rank(char const* name, std::size_t length) noexcept
+        {
+            arch_rank_finder finder { name, length, 0, -1 };
+            all_architectures::for_each(finder);
+            return finder.found;
+        }
+
+        // Checks whether Derived is, or is based on, an architecture named
+        // after name.
+        template <class Derived>
+        struct arch_base_finder
+        {
+            char const* name;
+            std::size_t length;
+            bool found;
+
+            template <class Arch>
+            XSIMD_INLINE void operator()(Arch) noexcept
+            {
+                found = found || (std::is_base_of<Arch, Derived>::value && arch_name_equals(Arch::name(), name, length));
+            }
+        };
+
+        // Marks as unavailable the supported architectures ranked before the
+        // one of rank cap, or based on the one named after name.
+        struct arch_restriction
+        {
+            supported_arch& archs;
+            char const* name;
+            std::size_t length;
+            int cap;
+
+            template <class Arch>
+            XSIMD_INLINE void operator()(Arch) noexcept
+            {
+                bool restricted;
+                if (cap >= 0)
+                {
+                    restricted = arch_rank(Arch::name(), std::strlen(Arch::name())) < cap;
+                }
+                else
+                {
+                    arch_base_finder<Arch> finder { name, length, false };
+                    all_architectures::for_each(finder);
+                    restricted = finder.found;
+                }
+                if (restricted)
+                    archs.set(Arch {}, false);
+            }
+        };
+
+        XSIMD_INLINE bool force_arch(supported_arch& archs, char const* name, std::size_t length) noexcept
+        {
+            int rank = arch_rank(name, length);
+            if (rank < 0)
+                return false;
+            supported_architectures::for_each(arch_restriction { archs, name, length, rank });
+            return true;
+        }
+
+        XSIMD_INLINE bool disable_arch(supported_arch& archs, char const* name, std::size_t length) noexcept
+        {
+            if (arch_rank(name, length) < 0)
+                return false;
+            supported_architectures::for_each(arch_restriction { archs, name, length, -1 });
+            return true;
+        }
+
+        XSIMD_INLINE char const* arch_environment(char const* variable) noexcept
+        {
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4996)
+#endif
+            return std::getenv(variable);
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+        }
+
+        XSIMD_INLINE void apply_arch_environment(supported_arch& archs) noexcept
+        {
+            if (char const* forced = arch_environment("XSIMD_FORCE_ARCH"))
+                force_arch(archs, forced, std::strlen(forced));
+            if (char const* disabled = arch_environment("XSIMD_DISABLE_ARCH"))
+            {
+                // comma separated list of names
+                while (*disabled)
+                {
+                    std::size_t length = std::strcspn(disabled, ",");
+                    disable_arch(archs, disabled, length);
+                    disabled += length + (disabled[length] == ',');
+                }
+            }
+        }
+    } // namespace detail
+
+    /**
+     * @ingroup architectures
+     *
+     * Caps the architectures considered available, and therefore used by
+     * \ref dispatch, to the architecture called \c name (as returned by
+     * its \c name() method) and the ones ranked after it in
+     * \c all_architectures, e.g. \c "avx2" to avoid AVX-512. The
+     * environment variable \c XSIMD_FORCE_ARCH has the same effect when the
+     * architectures are first detected.
+     *
+     * This is meant to be called at startup: dispatchers already created,
+     * by \ref resolve_dispatch or \ref dispatch_pointer, keep their
+     * architecture.
+     * @return false, leaving the architectures unchanged, if \c name is unknown
+     */
+    XSIMD_INLINE bool force_architecture(char const* name) noexcept
+    {
+        return detail::force_arch(detail::available_architectures_cache(), name, std::strlen(name));
+    }
+
+    /**
+     * @ingroup architectures
+     *
+     * Marks the architecture called \c name, and every architecture based
+     * on it, as unavailable for \ref dispatch, e.g. \c "avx512f" disables
+     * all the AVX-512 architectures. The environment variable
+     * \c XSIMD_DISABLE_ARCH, a comma separated list of names, has the same
+     * effect when the architectures are first detected.
+     *
+     * This is meant to be called at startup, see \ref force_architecture.
+     * @return false, leaving the architectures unchanged, if \c name is unknown
+     */
+    XSIMD_INLINE bool disable_architecture(char const* name) noexcept
+    {
+        return detail::disable_arch(detail::available_architectures_cache(), name, std::strlen(name));
+    }
+
+    /**
+     * @ingroup architectures
+     *
+     * Restores the architectures available at startup, environment
+     * variables included, undoing \ref force_architecture and
+     * \ref disable_architecture.
+     */
+    XSIMD_INLINE void reset_architectures() noexcept
+    {
+        detail::available_architectures_cache() = detail::detected_architectures();
+    }
+
     namespace detail
     {
         template <class F, class ArchList>
@@ -224,6 +431,123 @@ namespace xsimd
                 return walk_archs(ArchList {}, std::forward<Tys>(args)...);
             }
         };
+
+        // Returns the entry of Target for the first architecture of the
+        // list available at runtime.
+        template <class Target, class Arch>
+        XSIMD_INLINE typename Target::pointer_type resolve_archs(arch_list<Arch>, supported_arch const&) noexcept
+        {
+            assert(Arch::available() && "At least one arch must be supported during dispatch");
+            return Target::template entry<Arch>();
+        }
+
+        template <class Target, class Arch, class ArchNext, class... Archs>
+        XSIMD_INLINE typename Target::pointer_type resolve_archs(arch_list<Arch, ArchNext, Archs...>, supported_arch const& availables_archs) noexcept
+        {
+            if (availables_archs.has(Arch {}))
+                return Target::template entry<Arch>();
+            else
+                return resolve_archs<Target>(arch_list<ArchNext, Archs...> {}, availables_archs);
+        }
+
+        template <class F, class Signature>
+        struct functor_entries;
+
+        template <class F, class R, class... Args>
+        struct functor_entries<F, R(Args...)>
+        {
+            using pointer_type = R (*)(F&, Args...);
+
+            template <class Arch>
+            static R call(F& f, Args... args)
+            {
+                return f(Arch {}, std::forward<Args>(args)...);
+            }
+
+            template <class Arch>
+            static pointer_type entry() noexcept
+            {
+                return &call<Arch>;
+            }
+        };
+
+        template <class F, class Signature>
+        struct stateless_entries;
+
+        template <class F, class R, class... Args>
+        struct stateless_entries<F, R(Args...)>
+        {
+            using pointer_type = R (*)(Args...);
+
+            template <class Arch>
+            static R call(Args... args)
+            {
+                return F {}(Arch {}, std::forward<Args>(args)...);
+            }
+
+            template <class Arch>
+            static pointer_type entry() noexcept
+            {
+                return &call<Arch>;
+            }
+        };
+
+        template <class F, class ArchList, class Signature>
+        class resolved_dispatcher;
+
+        template <class F, class ArchList, class R, class... Args>
+        class resolved_dispatcher<F, ArchList, R(Args...)>
+        {
+            using entries = functor_entries<F, R(Args...)>;
+
+            F functor;
+            typename entries::pointer_type target;
+
+        public:
+            XSIMD_INLINE resolved_dispatcher(F f) noexcept
+                : functor(f)
+                , target(resolve_archs<entries>(ArchList {}, available_architectures()))
+            {
+            }
+
+            XSIMD_INLINE R operator()(Args... args) noexcept
+            {
+                return target(functor, std::forward<Args>(args)...);
+            }
+        };
+
+        // The slot initially holds a trampoline that resolves the
+        // architecture, stores the matching entry in the slot and forwards
+        // the call: later calls only cost an indirect call. Being constant
+        // initialized, the slot can be used during static initialization.
+        // dispatch_pointer resolves eagerly so that callers keeping the
+        // pointer never hold the trampoline.
+        template <class F, class ArchList, class Signature>
+        struct dispatch_slot;
+
+        template <class F, class ArchList, class R, class... Args>
+        struct dispatch_slot<F, ArchList, R(Args...)>
+        {
+            using entries = stateless_entries<F, R(Args...)>;
+            using pointer_type = typename entries::pointer_type;
+
+            static std::atomic<pointer_type> target;
+
+            static pointer_type resolve() noexcept
+            {
+                pointer_type resolved = resolve_archs<entries>(ArchList {}, available_architectures());
+                target.store(resolved, std::memory_order_relaxed);
+                return resolved;
+            }
+
+            static R resolve_and_call(Args... args)
+            {
+                return resolve()(std::forward<Args>(args)...);
+            }
+        };
+
+        template <class F, class ArchList, class R, class... Args>
+        std::atomic<typename dispatch_slot<F, ArchList, R(Args...)>::pointer_type> dispatch_slot<F, ArchList, R(Args...)>::target { &dispatch_slot<F, ArchList, R(Args...)>::resolve_and_call };
     }
 
     // Generic function dispatch, à la ifunc
@@ -233,6 +557,37 @@ namespace xsimd
         return { std::forward<F>(f) };
     }
 
+    /**
+     * Function dispatch resolved once: the best architecture of \c ArchList
+     * available at runtime is selected when the dispatcher is created, and
+     * each call then costs a single indirect call. \c Signature is the
+     * signature of the resulting call operator, e.g.
+     * <tt>float(float const*, unsigned)</tt>.
+     */
+    template <class Signature, class ArchList = supported_architectures, class F>
+    XSIMD_INLINE detail::resolved_dispatcher<typename std::decay<F>::type, ArchList, Signature> resolve_dispatch(F&& f) noexcept
+    {
+        return { std::forward<F>(f) };
+    }
+
+    /**
+     * Process-wide function dispatch of the default constructible functor
+     * \c F, à la ifunc: returns a pointer to a function of signature
+     * \c Signature calling <tt>F {}(arch, args...)</tt> for the best
+     * architecture of \c ArchList available at runtime. The architecture is
+     * resolved by the first call to \c dispatch_pointer and then shared by
+     * all the callers using the same \c F, \c Signature and \c ArchList.
+     */
+    template <class F, class Signature, class ArchList = supported_architectures>
+    XSIMD_INLINE typename detail::dispatch_slot<F, ArchList, Signature>::pointer_type dispatch_pointer() noexcept
+    {
+        using slot = detail::dispatch_slot<F, ArchList, Signature>;
+        auto target = slot::target.load(std::memory_order_relaxed);
+        if (target == &slot::resolve_and_call)
+            target = slot::resolve();
+        return target;
+    }
+
 } // namespace xsimd
 
 #endif
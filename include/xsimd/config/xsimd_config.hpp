@@ -110,6 +110,18 @@
 #define XSIMD_WITH_AVXVNNI 0
 #endif
 
+/**
+ * @ingroup xsimd_config_macro
+ *
+ * Set to 1 if F16C (half precision conversions) is available at
+ * compile-time, to 0 otherwise.
+ */
+#ifdef __F16C__
+#define XSIMD_WITH_F16C 1
+#else
+#define XSIMD_WITH_F16C 0
+#endif
+
 /**
  * @ingroup xsimd_config_macro
  *
@@ -306,7 +318,7 @@
  */
 #ifdef __AVX512VNNI__
 
-#if XSIMD_WITH_AVX512_VBMI
+#if XSIMD_WITH_AVX512VBMI
 #define XSIMD_WITH_AVX512VNNI_AVX512VBMI XSIMD_WITH_AVX512F
 #define XSIMD_WITH_AVX512VNNI_AVX512BW XSIMD_WITH_AVX512F
 #else
@@ -321,6 +333,17 @@
 
 #endif
 
+/**
+ * @ingroup xsimd_config_macro
+ *
+ * Set to 1 if AVX512BF16 is available at compile-time, to 0 otherwise.
+ */
+#ifdef __AVX512BF16__
+#define XSIMD_WITH_AVX512BF16 XSIMD_WITH_AVX512VNNI_AVX512VBMI
+#else
+#define XSIMD_WITH_AVX512BF16 0
+#endif
+
 #ifdef __ARM_NEON
 
 /**
@@ -0,0 +1,210 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#ifndef XSIMD_CPU_INFO_HPP
+#define XSIMD_CPU_INFO_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "./xsimd_get_cpuid.hpp"
+
+namespace xsimd
+{
+    namespace detail
+    {
+#if defined(__linux__)
+        // Reads the first line of a sysfs file, without its trailing newline.
+        XSIMD_INLINE bool read_sysfs(char const* path, char* buffer, int size) noexcept
+        {
+            FILE* file = std::fopen(path, "r");
+            if (!file)
+                return false;
+            bool read = std::fgets(buffer, size, file) != nullptr;
+            std::fclose(file);
+            if (read)
+                buffer[std::strcspn(buffer, "\n")] = '\0';
+            return read;
+        }
+
+        // Parses a sysfs size, such as "32K" or "16M", in bytes.
+        XSIMD_INLINE std::size_t parse_sysfs_size(char const* value) noexcept
+        {
+            char* suffix;
+            std::size_t size = std::strtoul(value, &suffix, 10);
+            if (*suffix == 'K')
+                size <<= 10;
+            else if (*suffix == 'M')
+                size <<= 20;
+            else if (*suffix == 'G')
+                size <<= 30;
+            return size;
+        }
+#endif
+
+        struct cpu_properties
+        {
+            // Cache sizes, in bytes, 0 when unknown.
+            std::size_t l1d_cache_size;
+            std::size_t l2_cache_size;
+            std::size_t l3_cache_size;
+            std::size_t cache_line_size;
+            // Core counts, 0 when unknown.
+            unsigned physical_cores;
+            unsigned logical_cores;
+
+            XSIMD_INLINE cpu_properties() noexcept
+            {
+                memset(this, 0, sizeof(cpu_properties));
+                logical_cores = std::thread::hardware_concurrency();
+                unsigned threads_per_core = 1;
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_AMD64) || defined(_M_IX86)
+                int regs0[4];
+                get_cpuid(regs0, 0x0);
+                int max_level = regs0[0];
+                // "AuthenticAMD" or "HygonGenuine"
+                bool amd = regs0[1] == 0x68747541 || regs0[1] == 0x6f677948;
+
+                int regs8[4];
+                get_cpuid(regs8, 0x80000000);
+                unsigned max_extended_level = static_cast<unsigned>(regs8[0]);
+                int regs81[4];
+                get_cpuid(regs81, 0x80000001);
+                bool topology_extensions = max_extended_level >= 0x8000001D && (regs81[2] >> 22 & 1);
+
+                // deterministic cache parameters, same layout on Intel and AMD
+                int cache_level = amd ? (topology_extensions ? 0x8000001D : 0) : (max_level >= 0x4 ? 0x4 : 0);
+                for (int index = 0; cache_level && index < 16; ++index)
+                {
+                    int regs[4];
+                    get_cpuid(regs, cache_level, index);
+                    unsigned type = regs[0] & 0x1f;
+                    // no more caches
+                    if (type == 0)
+                        break;
+                    // instruction cache
+                    if (type == 2)
+                        continue;
+                    unsigned ebx = static_cast<unsigned>(regs[1]);
+                    std::size_t line_size = (ebx & 0xfff) + 1;
+                    std::size_t size = std::size_t((ebx >> 22) + 1) * ((ebx >> 12 & 0x3ff) + 1) * line_size * (static_cast<unsigned>(regs[2]) + 1);
+                    set_cache(regs[0] >> 5 & 0x7, size, line_size);
+                }
+
+                // legacy AMD cache descriptors
+                if (amd && !topology_extensions && max_extended_level >= 0x80000006)
+                {
+                    int regs85[4], regs86[4];
+                    get_cpuid(regs85, 0x80000005);
+                    get_cpuid(regs86, 0x80000006);
+                    set_cache(1, std::size_t(static_cast<unsigned>(regs85[2]) >> 24) << 10, regs85[2] & 0xff);
+                    set_cache(2, std::size_t(static_cast<unsigned>(regs86[2]) >> 16) << 10, regs86[2] & 0xff);
+                    set_cache(3, std::size_t(static_cast<unsigned>(regs86[3]) >> 18) << 19, regs86[3] & 0xff);
+                }
+
+                // threads per core
+                if (amd && max_extended_level >= 0x8000001E)
+                {
+                    int regs[4];
+                    get_cpuid(regs, 0x8000001E);
+                    threads_per_core = (regs[1] >> 8 & 0xff) + 1;
+                }
+                else if (!amd && max_level >= 0xB)
+                {
+                    int regs[4];
+                    get_cpuid(regs, 0xB, 0);
+                    // SMT level
+                    if ((regs[2] >> 8 & 0xff) == 1)
+                        threads_per_core = regs[1] & 0xffff;
+                }
+#endif
+
+#if defined(__linux__)
+                char path[96];
+                char value[32];
+                // only when CPUID did not describe the caches
+                bool sysfs_caches = l1d_cache_size == 0;
+                for (int index = 0; sysfs_caches && index < 16; ++index)
+                {
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/type", index);
+                    if (!read_sysfs(path, value, sizeof(value)))
+                        break;
+                    if (std::strcmp(value, "Instruction") == 0)
+                        continue;
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/level", index);
+                    unsigned level = read_sysfs(path, value, sizeof(value)) ? unsigned(std::strtoul(value, nullptr, 10)) : 0;
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/size", index);
+                    std::size_t size = read_sysfs(path, value, sizeof(value)) ? parse_sysfs_size(value) : 0;
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/coherency_line_size", index);
+                    std::size_t line_size = read_sysfs(path, value, sizeof(value)) ? parse_sysfs_size(value) : 0;
+                    set_cache(level, size, line_size);
+                }
+
+                // a core is counted once, through its first hardware thread
+                unsigned cores = 0;
+                for (unsigned cpu = 0; cpu < logical_cores; ++cpu)
+                {
+                    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/thread_siblings_list", cpu);
+                    if (!read_sysfs(path, value, sizeof(value)))
+                    {
+                        cores = 0;
+                        break;
+                    }
+                    cores += std::strtoul(value, nullptr, 10) == cpu;
+                }
+                physical_cores = cores;
+#endif
+
+                if (physical_cores == 0 && logical_cores != 0)
+                    physical_cores = std::max(logical_cores / std::max(threads_per_core, 1u), 1u);
+            }
+
+        private:
+            XSIMD_INLINE void set_cache(unsigned level, std::size_t size, std::size_t line_size) noexcept
+            {
+                switch (level)
+                {
+                case 1:
+                    l1d_cache_size = size;
+                    cache_line_size = line_size;
+                    break;
+                case 2:
+                    l2_cache_size = size;
+                    break;
+                case 3:
+                    l3_cache_size = size;
+                    break;
+                default:
+                    break;
+                }
+            }
+        };
+    } // namespace detail
+
+    /**
+     * Returns the cache sizes, cache line size and core counts of the
+     * processor running the program, e.g. to choose block sizes at runtime.
+     * They are read once, from CPUID on x86 and from sysfs on Linux, and
+     * unknown values are 0.
+     */
+    XSIMD_INLINE detail::cpu_properties cpu_info() noexcept
+    {
+        static detail::cpu_properties info;
+        return info;
+    }
+}
+
+#endif
@@ -15,7 +15,7 @@
 #include <algorithm>
 #include <cstring>
 
-#if defined(__linux__) && (defined(__ARM_NEON) || defined(_M_ARM) || defined(__riscv_vector))
+#if defined(__linux__) && (defined(__ARM_NEON) || defined(_M_ARM) || defined(__riscv))
 #include <asm/hwcap.h>
 #include <sys/auxv.h>
 
@@ -25,12 +25,30 @@
 
 #endif
 
+#if defined(__linux__) && defined(__aarch64__)
+#include <sys/prctl.h>
+
+#ifndef HWCAP_SVE
+#define HWCAP_SVE (1 << 22)
+#endif
+
+#ifndef PR_SVE_GET_VL
+#define PR_SVE_GET_VL 51
+#endif
+
+#ifndef PR_SVE_VL_LEN_MASK
+#define PR_SVE_VL_LEN_MASK 0xffff
+#endif
+
+#endif
+
 #if defined(_MSC_VER)
-// Contains the definition of __cpuidex
+// Contains the definition of _xgetbv
 #include <intrin.h>
 #endif
 
 #include "../types/xsimd_all_registers.hpp"
+#include "./xsimd_get_cpuid.hpp"
 
 namespace xsimd
 {
@@ -39,9 +57,10 @@ namespace xsimd
         struct supported_arch
         {
 
-#define ARCH_FIELD_EX(arch, field_name) \
-    unsigned field_name;                \
-    XSIMD_INLINE bool has(::xsimd::arch) const { return this->field_name; }
+#define ARCH_FIELD_EX(arch, field_name)                                     \
+    unsigned field_name;                                                    \
+    XSIMD_INLINE bool has(::xsimd::arch) const { return this->field_name; } \
+    XSIMD_INLINE void set(::xsimd::arch, bool value) { this->field_name = value; }
 #define ARCH_FIELD(name) ARCH_FIELD_EX(name, name)
 
             ARCH_FIELD(sse2)
@@ -66,18 +85,39 @@ namespace xsimd
             ARCH_FIELD(avx512er)
             ARCH_FIELD(avx512pf)
             ARCH_FIELD(avx512ifma)
+            ARCH_FIELD(avx512bf16)
             ARCH_FIELD(avx512vbmi)
             ARCH_FIELD_EX(avx512vnni<::xsimd::avx512bw>, avx512vnni_bw)
             ARCH_FIELD_EX(avx512vnni<::xsimd::avx512vbmi>, avx512vnni_vbmi)
             ARCH_FIELD(neon)
             ARCH_FIELD(neon64)
             ARCH_FIELD_EX(i8mm<::xsimd::neon64>, i8mm_neon64)
-            ARCH_FIELD(sve)
-            ARCH_FIELD(rvv)
             ARCH_FIELD(wasm)
 
 #undef ARCH_FIELD
 
+// Fixed size architectures over a scalable instruction set, only available
+// when the runtime vector length, in bits, matches their size.
+#define ARCH_FIELD_SIZED(name)                                      \
+    unsigned name;                                                  \
+    unsigned name##_bits;                                           \
+    template <size_t Width>                                         \
+    XSIMD_INLINE bool has(::xsimd::detail::name<Width>) const       \
+    {                                                               \
+        return this->name && this->name##_bits == Width;            \
+    }                                                               \
+    template <size_t Width>                                         \
+    XSIMD_INLINE void set(::xsimd::detail::name<Width>, bool value) \
+    {                                                               \
+        if (this->name##_bits == Width)                             \
+            this->name = value;                                     \
+    }
+
+            ARCH_FIELD_SIZED(sve)
+            ARCH_FIELD_SIZED(rvv)
+
+#undef ARCH_FIELD_SIZED
+
             XSIMD_INLINE supported_arch() noexcept
             {
                 memset(this, 0, sizeof(supported_arch));
@@ -91,6 +131,13 @@ namespace xsimd
                 neon64 = 1;
 #if defined(__linux__) && (!defined(__ANDROID_API__) || __ANDROID_API__ >= 18)
                 i8mm_neon64 = bool(getauxval(AT_HWCAP2) & HWCAP2_I8MM);
+                sve = bool(getauxval(AT_HWCAP) & HWCAP_SVE);
+                if (sve)
+                {
+                    // current vector length of the thread, in bytes
+                    int vl = prctl(PR_SVE_GET_VL);
+                    sve_bits = vl < 0 ? 0 : (vl & PR_SVE_VL_LEN_MASK) * 8;
+                }
 #endif
 #elif defined(__ARM_NEON) || defined(_M_ARM)
 
@@ -98,46 +145,40 @@ namespace xsimd
                 neon = bool(getauxval(AT_HWCAP) & HWCAP_NEON);
 #endif
 
-#elif defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS) && __ARM_FEATURE_SVE_BITS > 0
-
-#if defined(__linux__) && (!defined(__ANDROID_API__) || __ANDROID_API__ >= 18)
-                sve = bool(getauxval(AT_HWCAP) & HWCAP_SVE);
-#endif
-
-#elif defined(__riscv_vector) && defined(__riscv_v_fixed_vlen) && __riscv_v_fixed_vlen > 0
+#elif defined(__riscv)
 
 #if defined(__linux__) && (!defined(__ANDROID_API__) || __ANDROID_API__ >= 18)
 #ifndef HWCAP_V
 #define HWCAP_V (1 << ('V' - 'A'))
 #endif
                 rvv = bool(getauxval(AT_HWCAP) & HWCAP_V);
+                if (rvv)
+                {
+                    // vlenb, the vector register length in bytes, read through
+                    // its number so that it assembles without the V extension
+                    unsigned long vlenb;
+                    __asm__ volatile("csrr %0, 0xc22"
+                                     : "=r"(vlenb));
+                    rvv_bits = static_cast<unsigned>(vlenb * 8);
+                }
 #endif
 
 #elif defined(__x86_64__) || defined(__i386__) || defined(_M_AMD64) || defined(_M_IX86)
-                auto get_cpuid = [](int reg[4], int level, int count = 0) noexcept
+                // Extended control register 0 tells which register states the
+                // OS saves on context switches, hence which instructions can
+                // actually be used.
+                auto get_xcr0 = []() noexcept -> unsigned long long
                 {
 
-#if defined(_MSC_VER)
-                    __cpuidex(reg, level, count);
-
-#elif defined(__INTEL_COMPILER)
-                    __cpuid(reg, level);
+#if defined(_MSC_VER) || defined(__INTEL_COMPILER)
+                    return _xgetbv(0);
 
 #elif defined(__GNUC__) || defined(__clang__)
-
-#if defined(__i386__) && defined(__PIC__)
-                    // %ebx may be the PIC register
-                    __asm__("xchg{l}\t{%%}ebx, %1\n\t"
-                            "cpuid\n\t"
-                            "xchg{l}\t{%%}ebx, %1\n\t"
-                            : "=a"(reg[0]), "=r"(reg[1]), "=c"(reg[2]), "=d"(reg[3])
-                            : "0"(level), "2"(count));
-
-#else
-                    __asm__("cpuid\n\t"
-                            : "=a"(reg[0]), "=b"(reg[1]), "=c"(reg[2]), "=d"(reg[3])
-                            : "0"(level), "2"(count));
-#endif
+                    unsigned eax, edx;
+                    __asm__("xgetbv\n\t"
+                            : "=a"(eax), "=d"(edx)
+                            : "c"(0));
+                    return (static_cast<unsigned long long>(edx) << 32) | eax;
 
 #else
 #error "Unsupported configuration"
@@ -148,19 +189,26 @@ namespace xsimd
 
                 get_cpuid(regs1, 0x1);
 
+                // xgetbv is only available if the OS enabled it (OSXSAVE)
+                unsigned long long xcr0 = (regs1[2] >> 27 & 1) ? get_xcr0() : 0;
+                // SSE and AVX (YMM) states, required by any VEX encoded instruction
+                bool os_avx = (xcr0 & 0x6) == 0x6;
+                // opmask, ZMM_Hi256 and Hi16_ZMM states
+                bool os_avx512 = os_avx && (xcr0 & 0xe0) == 0xe0;
+
                 sse2 = regs1[3] >> 26 & 1;
                 sse3 = regs1[2] >> 0 & 1;
                 ssse3 = regs1[2] >> 9 & 1;
                 sse4_1 = regs1[2] >> 19 & 1;
                 sse4_2 = regs1[2] >> 20 & 1;
-                fma3_sse42 = regs1[2] >> 12 & 1;
+                fma3_sse42 = os_avx && (regs1[2] >> 12 & 1);
 
-                avx = regs1[2] >> 28 & 1;
+                avx = os_avx && (regs1[2] >> 28 & 1);
                 fma3_avx = avx && fma3_sse42;
 
                 int regs8[4];
                 get_cpuid(regs8, 0x80000001);
-                fma4 = regs8[2] >> 16 & 1;
+                fma4 = os_avx && (regs8[2] >> 16 & 1);
 
                 // sse4a = regs[2] >> 6 & 1;
 
@@ -168,33 +216,50 @@ namespace xsimd
 
                 int regs7[4];
                 get_cpuid(regs7, 0x7);
-                avx2 = regs7[1] >> 5 & 1;
+                avx2 = os_avx && (regs7[1] >> 5 & 1);
 
                 int regs7a[4];
                 get_cpuid(regs7a, 0x7, 0x1);
-                avxvnni = regs7a[0] >> 4 & 1;
+                avxvnni = os_avx && (regs7a[0] >> 4 & 1);
 
                 fma3_avx2 = avx2 && fma3_sse42;
 
-                avx512f = regs7[1] >> 16 & 1;
-                avx512cd = regs7[1] >> 28 & 1;
-                avx512dq = regs7[1] >> 17 & 1;
-                avx512bw = regs7[1] >> 30 & 1;
-                avx512er = regs7[1] >> 27 & 1;
-                avx512pf = regs7[1] >> 26 & 1;
-                avx512ifma = regs7[1] >> 21 & 1;
-                avx512vbmi = regs7[2] >> 1 & 1;
-                avx512vnni_bw = regs7[2] >> 11 & 1;
+                avx512f = os_avx512 && (regs7[1] >> 16 & 1);
+                avx512cd = os_avx512 && (regs7[1] >> 28 & 1);
+                avx512dq = os_avx512 && (regs7[1] >> 17 & 1);
+                avx512bw = os_avx512 && (regs7[1] >> 30 & 1);
+                avx512er = os_avx512 && (regs7[1] >> 27 & 1);
+                avx512pf = os_avx512 && (regs7[1] >> 26 & 1);
+                avx512ifma = os_avx512 && (regs7[1] >> 21 & 1);
+                avx512vbmi = os_avx512 && (regs7[2] >> 1 & 1);
+                avx512vnni_bw = os_avx512 && (regs7[2] >> 11 & 1);
                 avx512vnni_vbmi = avx512vbmi && avx512vnni_bw;
+                avx512bf16 = avx512vnni_vbmi && (regs7a[0] >> 5 & 1);
 #endif
             }
         };
+
+        // Applies the XSIMD_FORCE_ARCH and XSIMD_DISABLE_ARCH environment
+        // variables, defined along with the list of all architectures.
+        XSIMD_INLINE void apply_arch_environment(supported_arch& archs) noexcept;
+
+        XSIMD_INLINE supported_arch detected_architectures() noexcept
+        {
+            supported_arch archs;
+            apply_arch_environment(archs);
+            return archs;
+        }
+
+        XSIMD_INLINE supported_arch& available_architectures_cache() noexcept
+        {
+            static supported_arch supported = detected_architectures();
+            return supported;
+        }
     } // namespace detail
 
     XSIMD_INLINE detail::supported_arch available_architectures() noexcept
     {
-        static detail::supported_arch supported;
-        return supported;
+        return detail::available_architectures_cache();
     }
 }
 
@@ -0,0 +1,60 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#ifndef XSIMD_GET_CPUID_HPP
+#define XSIMD_GET_CPUID_HPP
+
+#if defined(_MSC_VER)
+// Contains the definition of __cpuidex
+#include <intrin.h>
+#endif
+
+#include "./xsimd_inline.hpp"
+
+namespace xsimd
+{
+    namespace detail
+    {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_AMD64) || defined(_M_IX86)
+        XSIMD_INLINE void get_cpuid(int reg[4], int level, int count = 0) noexcept
+        {
+
+#if defined(_MSC_VER)
+            __cpuidex(reg, level, count);
+
+#elif defined(__INTEL_COMPILER)
+            __cpuid(reg, level);
+
+#elif defined(__GNUC__) || defined(__clang__)
+
+#if defined(__i386__) && defined(__PIC__)
+            // %ebx may be the PIC register
+            __asm__("xchg{l}\t{%%}ebx, %1\n\t"
+                    "cpuid\n\t"
+                    "xchg{l}\t{%%}ebx, %1\n\t"
+                    : "=a"(reg[0]), "=r"(reg[1]), "=c"(reg[2]), "=d"(reg[3])
+                    : "0"(level), "2"(count));
+
+#else
+            __asm__("cpuid\n\t"
+                    : "=a"(reg[0]), "=b"(reg[1]), "=c"(reg[2]), "=d"(reg[3])
+                    : "0"(level), "2"(count));
+#endif
+
+#else
+#error "Unsupported configuration"
+#endif
+        }
+#endif
+    }
+}
+
+#endif
@@ -0,0 +1,1146 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#ifndef XSIMD_ALGORITHMS_HPP
+#define XSIMD_ALGORITHMS_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "../xsimd.hpp"
+
+#ifndef XSIMD_NO_SUPPORTED_ARCHITECTURE
+
+namespace xsimd
+{
+    namespace detail
+    {
+        template <class I>
+        using enable_if_iterator_t = void_t<decltype(*std::declval<I&>()), decltype(++std::declval<I&>())>;
+
+        template <class C>
+        using enable_if_container_t = void_t<decltype(std::declval<C&>().data()), decltype(std::declval<C&>().size())>;
+
+        template <class M1, class M2>
+        struct common_alignment
+        {
+            using type = unaligned_mode;
+        };
+
+        template <>
+        struct common_alignment<aligned_mode, aligned_mode>
+        {
+            using type = aligned_mode;
+        };
+
+        template <class M1, class M2>
+        using common_alignment_t = typename common_alignment<M1, M2>::type;
+
+        struct plus
+        {
+            template <class X, class Y>
+            XSIMD_INLINE auto operator()(X const& x, Y const& y) const noexcept -> decltype(x + y)
+            {
+                return x + y;
+            }
+        };
+
+        // Number of leading elements to process before ptr reaches the
+        // alignment of Arch. Pointers that can never be aligned, because
+        // they are not aligned on their element size, are not peeled.
+        template <class Arch, class T>
+        XSIMD_INLINE std::size_t alignment_head(T const* ptr, std::size_t size, unaligned_mode) noexcept
+        {
+            constexpr std::size_t size_of_batch = batch<T, Arch>::size;
+            std::size_t head = get_alignment_offset(ptr, size, size_of_batch);
+            return head < size_of_batch ? head : 0;
+        }
+
+        template <class Arch, class T>
+        XSIMD_INLINE std::size_t alignment_head(T const* ptr, std::size_t, aligned_mode) noexcept
+        {
+            assert(is_aligned<Arch>(ptr) && "container allocator must provide the alignment of the architecture");
+            (void)ptr;
+            return 0;
+        }
+
+        // Loads the 0 < n < size first elements of in. load_partial leaves
+        // zeros in the other lanes, they repeat in[0] instead so that a
+        // functor valid on every element of the range, a division for
+        // instance, is valid on every lane.
+        template <class Arch, class T>
+        XSIMD_INLINE batch<T, Arch> load_partial_padded(T const* in, std::size_t n) noexcept
+        {
+            using batch_type = batch<T, Arch>;
+            auto valid = batch_type::batch_bool_type::from_mask((uint64_t(1) << n) - 1);
+            return select(valid, load_partial<Arch>(in, n), batch_type(in[0]));
+        }
+
+        /*************
+         * transform *
+         *************/
+
+        template <std::size_t Unroll, class B, class T, class U, class F, class LM, class SM>
+        XSIMD_INLINE std::size_t transform_batches(T const* in, U* out, std::size_t size, F& f, LM, SM)
+        {
+            constexpr std::size_t step = B::size;
+            std::size_t i = 0;
+            for (; i + Unroll * step <= size; i += Unroll * step)
+            {
+                for (std::size_t j = 0; j < Unroll; ++j)
+                {
+                    f(B::load(in + i + j * step, LM {})).store(out + i + j * step, SM {});
+                }
+            }
+            for (; i + step <= size; i += step)
+            {
+                f(B::load(in + i, LM {})).store(out + i, SM {});
+            }
+            return i;
+        }
+
+        template <std::size_t Unroll, class B, class T1, class T2, class U, class F, class LM, class SM>
+        XSIMD_INLINE std::size_t transform_batches(T1 const* in1, T2 const* in2, U* out, std::size_t size, F& f, LM, SM)
+        {
+            using batch_type_2 = batch<T2, typename B::arch_type>;
+            constexpr std::size_t step = B::size;
+            std::size_t i = 0;
+            for (; i + Unroll * step <= size; i += Unroll * step)
+            {
+                for (std::size_t j = 0; j < Unroll; ++j)
+                {
+                    std::size_t k = i + j * step;
+                    f(B::load(in1 + k, LM {}), batch_type_2::load(in2 + k, LM {})).store(out + k, SM {});
+                }
+            }
+            for (; i + step <= size; i += step)
+            {
+                f(B::load(in1 + i, LM {}), batch_type_2::load(in2 + i, LM {})).store(out + i, SM {});
+            }
+            return i;
+        }
+
+        template <class Arch, std::size_t Unroll, class T, class U, class F, class Mode>
+        XSIMD_INLINE void transform_range(T const* in, U* out, std::size_t size, F& f, Mode mode)
+        {
+            using batch_type = batch<T, Arch>;
+            static_assert(Unroll > 0, "unroll factor must be positive");
+            static_assert(batch_type::size == batch<U, Arch>::size, "transform requires input and output batches of the same size");
+
+            // peel the head with a partial batch so that the stores of the
+            // body are aligned
+            std::size_t head = alignment_head<Arch>(out, size, mode);
+            if (head != 0)
+            {
+                store_partial(out, f(load_partial_padded<Arch>(in, head)), head);
+                in += head;
+                out += head;
+                size -= head;
+            }
+
+            std::size_t done;
+            if (std::is_same<Mode, aligned_mode>::value || (is_aligned<Arch>(out) && is_aligned<Arch>(in)))
+                done = transform_batches<Unroll, batch_type>(in, out, size, f, aligned_mode {}, aligned_mode {});
+            else if (is_aligned<Arch>(out))
+                done = transform_batches<Unroll, batch_type>(in, out, size, f, unaligned_mode {}, aligned_mode {});
+            else
+                done = transform_batches<Unroll, batch_type>(in, out, size, f, unaligned_mode {}, unaligned_mode {});
+
+            if (done != size)
+            {
+                std::size_t tail = size - done;
+                store_partial(out + done, f(load_partial_padded<Arch>(in + done, tail)), tail);
+            }
+        }
+
+        template <class Arch, std::size_t Unroll, class T1, class T2, class U, class F, class Mode>
+        XSIMD_INLINE void transform_range(T1 const* in1, T2 const* in2, U* out, std::size_t size, F& f, Mode mode)
+        {
+            using batch_type = batch<T1, Arch>;
+            static_assert(Unroll > 0, "unroll factor must be positive");
+            static_assert(batch_type::size == batch<T2, Arch>::size && batch_type::size == batch<U, Arch>::size,
+                          "transform requires input and output batches of the same size");
+
+            std::size_t head = alignment_head<Arch>(out, size, mode);
+            if (head != 0)
+            {
+                store_partial(out, f(load_partial_padded<Arch>(in1, head), load_partial_padded<Arch>(in2, head)), head);
+                in1 += head;
+                in2 += head;
+                out += head;
+                size -= head;
+            }
+
+            std::size_t done;
+            if (std::is_same<Mode, aligned_mode>::value || (is_aligned<Arch>(out) && is_aligned<Arch>(in1) && is_aligned<Arch>(in2)))
+                done = transform_batches<Unroll, batch_type>(in1, in2, out, size, f, aligned_mode {}, aligned_mode {});
+            else if (is_aligned<Arch>(out))
+                done = transform_batches<Unroll, batch_type>(in1, in2, out, size, f, unaligned_mode {}, aligned_mode {});
+            else
+                done = transform_batches<Unroll, batch_type>(in1, in2, out, size, f, unaligned_mode {}, unaligned_mode {});
+
+            if (done != size)
+            {
+                std::size_t tail = size - done;
+                store_partial(out + done, f(load_partial_padded<Arch>(in1 + done, tail), load_partial_padded<Arch>(in2 + done, tail)), tail);
+            }
+        }
+
+        /**********
+         * reduce *
+         **********/
+
+        // Accumulates the size / B::size full batches of in, size must be
+        // at least B::size. Unroll independent accumulators hide the latency
+        // of op and are combined at the end.
+        template <std::size_t Unroll, class B, class T, class F, class LM>
+        XSIMD_INLINE B reduce_batches(T const* in, std::size_t size, F& op, LM)
+        {
+            constexpr std::size_t step = B::size;
+            B acc = B::load(in, LM {});
+            std::size_t i = step;
+            if (Unroll > 1 && size >= Unroll * step)
+            {
+                B accs[Unroll];
+                accs[0] = acc;
+                for (std::size_t j = 1; j < Unroll; ++j)
+                    accs[j] = B::load(in + j * step, LM {});
+                for (i = Unroll * step; i + Unroll * step <= size; i += Unroll * step)
+                {
+                    for (std::size_t j = 0; j < Unroll; ++j)
+                        accs[j] = op(accs[j], B::load(in + i + j * step, LM {}));
+                }
+                acc = accs[0];
+                for (std::size_t j = 1; j < Unroll; ++j)
+                    acc = op(acc, accs[j]);
+            }
+            for (; i + step <= size; i += step)
+            {
+                acc = op(acc, B::load(in + i, LM {}));
+            }
+            return acc;
+        }
+
+        template <class B, class F>
+        XSIMD_INLINE B reduce_partial(B const& acc, typename B::value_type const* in, std::size_t n, F& op)
+        {
+            using batch_bool_type = typename B::batch_bool_type;
+            auto mask = batch_bool_type::from_mask((uint64_t(1) << n) - 1);
+            return select(mask, op(acc, load_partial_padded<typename B::arch_type>(in, n)), acc);
+        }
+
+        // Horizontal reduction of the accumulator. The batch version of
+        // reduce relies on swizzles that are not available for every type
+        // and architecture, op is applied on the scalars instead.
+        template <class T, class A, class F>
+        XSIMD_INLINE T reduce_lanes(batch<T, A> const& acc, F& op)
+        {
+            alignas(A::alignment()) T buffer[batch<T, A>::size];
+            acc.store_aligned(buffer);
+            T res = buffer[0];
+            for (std::size_t i = 1; i < batch<T, A>::size; ++i)
+                res = static_cast<T>(op(res, buffer[i]));
+            return res;
+        }
+
+        template <class T, class A>
+        XSIMD_INLINE T reduce_lanes(batch<T, A> const& acc, plus&)
+        {
+            return reduce_add(acc);
+        }
+
+        template <class Arch, std::size_t Unroll, class T, class Init, class F, class Mode>
+        XSIMD_INLINE Init reduce_range(T const* in, std::size_t size, Init init, F& op, Mode mode)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t step = batch_type::size;
+            static_assert(Unroll > 0, "unroll factor must be positive");
+
+            // there is no identity element for an arbitrary op, the
+            // accumulator starts from the first full batch
+            if (size < step)
+            {
+                for (std::size_t i = 0; i < size; ++i)
+                    init = static_cast<Init>(op(init, in[i]));
+                return init;
+            }
+
+            std::size_t head = alignment_head<Arch>(in, size, mode);
+            if (size - head < step)
+                head = 0;
+
+            T const* body = in + head;
+            std::size_t body_size = size - head;
+            batch_type acc = std::is_same<Mode, aligned_mode>::value || is_aligned<Arch>(body)
+                ? reduce_batches<Unroll, batch_type>(body, body_size, op, aligned_mode {})
+                : reduce_batches<Unroll, batch_type>(body, body_size, op, unaligned_mode {});
+
+            if (head != 0)
+                acc = reduce_partial(acc, in, head, op);
+            std::size_t tail = body_size % step;
+            if (tail != 0)
+                acc = reduce_partial(acc, body + body_size - tail, tail, op);
+
+            return static_cast<Init>(op(init, reduce_lanes(acc, op)));
+        }
+
+        /********
+         * scan *
+         ********/
+
+        // Inclusive scan of in into out, starting from carry. The carry is
+        // kept broadcast in a batch and only depends on the previous carry
+        // through an addition, the horizontal part of the scan of each batch
+        // is off the critical path. The next batch is always loaded before
+        // the current one is stored, so that out may alias in, or start up
+        // to one batch after it.
+        template <class Arch, class T>
+        XSIMD_INLINE T scan_range(T const* in, T* out, std::size_t size, T init)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t step = batch_type::size;
+
+            batch_type carry(init);
+            if (size < step)
+            {
+                batch_type s = prefix_sum(load_partial<Arch>(in, size)) + carry;
+                store_partial(out, s, size);
+                return s.get(size - 1);
+            }
+
+            std::size_t i = 0;
+            batch_type x = batch_type::load_unaligned(in);
+            for (; i + 2 * step <= size; i += step)
+            {
+                batch_type next = batch_type::load_unaligned(in + i + step);
+                batch_type s = prefix_sum(x);
+                (s + carry).store_unaligned(out + i);
+                carry += batch_type(s.get(step - 1));
+                x = next;
+            }
+
+            std::size_t tail = size - i - step;
+            batch_type next = load_partial<Arch>(in + i + step, tail);
+            batch_type s = prefix_sum(x) + carry;
+            s.store_unaligned(out + i);
+            if (tail == 0)
+                return s.get(step - 1);
+            s = prefix_sum(next) + batch_type(s.get(step - 1));
+            store_partial(out + i + step, s, tail);
+            return s.get(tail - 1);
+        }
+
+        /***********
+         * extrema *
+         ***********/
+
+        struct min_first
+        {
+            static constexpr bool last = false;
+
+            template <class X>
+            static XSIMD_INLINE auto better(X const& x, X const& y) noexcept -> decltype(x < y)
+            {
+                return x < y;
+            }
+
+            template <class X>
+            static XSIMD_INLINE auto not_worse(X const& x, X const& y) noexcept -> decltype(x <= y)
+            {
+                return x <= y;
+            }
+        };
+
+        struct max_first
+        {
+            static constexpr bool last = false;
+
+            template <class X>
+            static XSIMD_INLINE auto better(X const& x, X const& y) noexcept -> decltype(x > y)
+            {
+                return x > y;
+            }
+
+            template <class X>
+            static XSIMD_INLINE auto not_worse(X const& x, X const& y) noexcept -> decltype(x >= y)
+            {
+                return x >= y;
+            }
+        };
+
+        struct max_last
+        {
+            static constexpr bool last = true;
+
+            template <class X>
+            static XSIMD_INLINE auto better(X const& x, X const& y) noexcept -> decltype(x > y)
+            {
+                return x > y;
+            }
+
+            template <class X>
+            static XSIMD_INLINE auto not_worse(X const& x, X const& y) noexcept -> decltype(x >= y)
+            {
+                return x >= y;
+            }
+        };
+
+        // Running extremum of a range according to P. Each lane of best
+        // holds the extremum of its own column of batches, and the number of
+        // the batch it was read from is tracked in the same lane of an
+        // unsigned integer batch of the same width. A lane only advances on
+        // a strictly better value, or on an equal one when the last
+        // occurrence is wanted, which keeps the tie breaking order.
+        template <class Arch, class T, class P>
+        struct extremum
+        {
+            using batch_type = batch<T, Arch>;
+            using index_type = as_unsigned_integer_t<T>;
+            using index_batch = batch<index_type, Arch>;
+
+            T value;
+            std::size_t pos;
+            batch_type best;
+            index_batch best_index;
+
+            explicit extremum(T const& first) noexcept
+                : value(first)
+                , pos(0)
+            {
+            }
+
+            XSIMD_INLINE void merge(T const& v, std::size_t p) noexcept
+            {
+                if (P::better(v, value) || (v == value && (P::last ? p > pos : p < pos)))
+                {
+                    value = v;
+                    pos = p;
+                }
+            }
+
+            XSIMD_INLINE void start(batch_type const& x) noexcept
+            {
+                best = x;
+                best_index = index_batch(index_type(0));
+            }
+
+            XSIMD_INLINE void update(batch_type const& x, index_batch const& index) noexcept
+            {
+                auto mask = P::last ? P::not_worse(x, best) : P::better(x, best);
+                best = select(mask, x, best);
+                best_index = select(batch_bool_cast<index_type>(mask), index, best_index);
+            }
+
+            // merges the lanes of the batches starting at base
+            XSIMD_INLINE void resolve(std::size_t base) noexcept
+            {
+                constexpr std::size_t step = batch_type::size;
+                alignas(Arch::alignment()) T values[step];
+                alignas(Arch::alignment()) index_type indexes[step];
+                best.store_aligned(values);
+                best_index.store_aligned(indexes);
+                for (std::size_t i = 0; i < step; ++i)
+                    merge(values[i], base + static_cast<std::size_t>(indexes[i]) * step + i);
+            }
+        };
+
+        // Batch numbers are stored on the width of T, so the range is
+        // processed in chunks of at most as many batches as the index type
+        // can count, the lanes being merged at the end of each chunk.
+        template <class Arch, class T, class LM, class... E>
+        XSIMD_INLINE void extremum_batches(T const* in, std::size_t count, std::size_t base, LM, E&... es)
+        {
+            using batch_type = batch<T, Arch>;
+            using index_type = as_unsigned_integer_t<T>;
+            using index_batch = batch<index_type, Arch>;
+            constexpr std::size_t step = batch_type::size;
+            constexpr std::size_t max_chunk = sizeof(index_type) < sizeof(std::size_t)
+                ? static_cast<std::size_t>(std::numeric_limits<index_type>::max())
+                : std::numeric_limits<std::size_t>::max();
+
+            for (std::size_t c = 0; c < count;)
+            {
+                std::size_t n = std::min(max_chunk, count - c);
+                T const* chunk = in + c * step;
+                batch_type x = batch_type::load(chunk, LM {});
+                (void)std::initializer_list<bool> { (es.start(x), true)... };
+                index_batch index(index_type(0));
+                for (std::size_t i = 1; i < n; ++i)
+                {
+                    index += index_batch(index_type(1));
+                    x = batch_type::load(chunk + i * step, LM {});
+                    (void)std::initializer_list<bool> { (es.update(x, index), true)... };
+                }
+                (void)std::initializer_list<bool> { (es.resolve(base + c * step), true)... };
+                c += n;
+            }
+        }
+
+        // The extrema must be initialized with in[0].
+        template <class Arch, class T, class... E>
+        XSIMD_INLINE void extremum_range(T const* in, std::size_t size, E&... es)
+        {
+            constexpr std::size_t step = batch<T, Arch>::size;
+            std::size_t head = alignment_head<Arch>(in, size, unaligned_mode {});
+            if (size - head < step)
+                head = size;
+            for (std::size_t i = 1; i < head; ++i)
+                (void)std::initializer_list<bool> { (es.merge(in[i], i), true)... };
+
+            std::size_t count = (size - head) / step;
+            if (count != 0)
+            {
+                if (is_aligned<Arch>(in + head))
+                    extremum_batches<Arch>(in + head, count, head, aligned_mode {}, es...);
+                else
+                    extremum_batches<Arch>(in + head, count, head, unaligned_mode {}, es...);
+            }
+
+            for (std::size_t i = head + count * step; i < size; ++i)
+                (void)std::initializer_list<bool> { (es.merge(in[i], i), true)... };
+        }
+
+        // mask of the first n lanes of a batch
+        XSIMD_INLINE uint64_t first_lanes(std::size_t n) noexcept
+        {
+            return n >= 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1;
+        }
+
+        /*************
+         * partition *
+         *************/
+
+        template <class Arch, class T, class P>
+        XSIMD_INLINE std::size_t copy_if_range(T const* in, T* out, std::size_t size, P& pred)
+        {
+            using batch_type = batch<T, Arch>;
+            using batch_bool_type = typename batch_type::batch_bool_type;
+            constexpr std::size_t step = batch_type::size;
+            std::size_t written = 0;
+            std::size_t i = 0;
+            for (; i + step <= size; i += step)
+            {
+                batch_type x = batch_type::load_unaligned(in + i);
+                written += compress_store(out + written, x, pred(x));
+            }
+            if (i != size)
+            {
+                batch_type x = load_partial_padded<Arch>(in + i, size - i);
+                written += compress_store(out + written, x, pred(x) & batch_bool_type::from_mask(first_lanes(size - i)));
+            }
+            return written;
+        }
+
+        // Stores the lanes of x selected by left after the elements already
+        // written at the front, and the ones selected by right before the
+        // elements already written at the back.
+        template <class B>
+        XSIMD_INLINE void partition_store(typename B::value_type* data, B const& x, typename B::batch_bool_type const& left,
+                                          typename B::batch_bool_type const& right, std::size_t& write_left, std::size_t& write_right) noexcept
+        {
+            write_left += compress_store(data + write_left, x, left);
+            write_right -= popcount(right.mask());
+            compress_store(data + write_right, x, right);
+        }
+
+        // In place partition: the elements for which pred holds are moved to
+        // the front and their count is returned. The first and last batches
+        // are kept in registers, which leaves room on both sides of the
+        // unread part of the range; the next batch is read on the side with
+        // the least room so that the partitioned elements never overwrite
+        // unread ones.
+        template <class Arch, class T, class P>
+        XSIMD_INLINE std::size_t partition_range(T* data, std::size_t size, P& pred)
+        {
+            using batch_type = batch<T, Arch>;
+            using batch_bool_type = typename batch_type::batch_bool_type;
+            constexpr std::size_t step = batch_type::size;
+            std::size_t write_left = 0, write_right = size;
+
+            if (size < 2 * step)
+            {
+                // the whole range fits in two registers
+                std::size_t size_0 = std::min(size, step), size_1 = size - size_0;
+                batch_type x0 = size_0 == step ? batch_type::load_unaligned(data) : load_partial_padded<Arch>(data, size_0);
+                auto valid_0 = batch_bool_type::from_mask(first_lanes(size_0));
+                auto left_0 = pred(x0);
+                if (size_1 == 0)
+                {
+                    partition_store(data, x0, left_0 & valid_0, ~left_0 & valid_0, write_left, write_right);
+                    return write_left;
+                }
+                batch_type x1 = load_partial_padded<Arch>(data + size_0, size_1);
+                auto valid_1 = batch_bool_type::from_mask(first_lanes(size_1));
+                auto left_1 = pred(x1);
+                partition_store(data, x0, left_0 & valid_0, ~left_0 & valid_0, write_left, write_right);
+                partition_store(data, x1, left_1 & valid_1, ~left_1 & valid_1, write_left, write_right);
+                return write_left;
+            }
+
+            batch_type front = batch_type::load_unaligned(data);
+            batch_type back = batch_type::load_unaligned(data + size - step);
+            std::size_t read_left = step, read_right = size - step;
+
+            while (read_right - read_left >= step)
+            {
+                batch_type x;
+                if (read_left - write_left <= write_right - read_right)
+                {
+                    x = batch_type::load_unaligned(data + read_left);
+                    read_left += step;
+                }
+                else
+                {
+                    read_right -= step;
+                    x = batch_type::load_unaligned(data + read_right);
+                }
+                auto left = pred(x);
+                partition_store(data, x, left, ~left, write_left, write_right);
+            }
+
+            std::size_t remaining = read_right - read_left;
+            if (remaining != 0)
+            {
+                batch_type x = load_partial_padded<Arch>(data + read_left, remaining);
+                auto valid = batch_bool_type::from_mask(first_lanes(remaining));
+                auto left = pred(x);
+                partition_store(data, x, left & valid, ~left & valid, write_left, write_right);
+            }
+            auto left = pred(front);
+            partition_store(data, front, left, ~left, write_left, write_right);
+            left = pred(back);
+            partition_store(data, back, left, ~left, write_left, write_right);
+            return write_left;
+        }
+
+        /********
+         * sort *
+         ********/
+
+        // Ranges of at most sort_blocks batches are sorted in registers:
+        // each batch is sorted, then the batches are merged by a bitonic
+        // network whose comparators are replaced by merge.
+        constexpr std::size_t sort_blocks = 8;
+
+        template <class Arch, class T>
+        XSIMD_INLINE void sort_small(T* data, std::size_t size) noexcept
+        {
+            using batch_type = batch<T, Arch>;
+            using batch_bool_type = typename batch_type::batch_bool_type;
+            constexpr std::size_t step = batch_type::size;
+            // padding lanes are sorted after the elements of the range
+            const batch_type padding(std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max());
+
+            std::size_t blocks = 1;
+            while (blocks * step < size)
+                blocks *= 2;
+
+            batch_type b[sort_blocks];
+            for (std::size_t i = 0; i < blocks; ++i)
+            {
+                std::size_t begin = i * step;
+                if (begin + step <= size)
+                    b[i] = batch_type::load_unaligned(data + begin);
+                else if (begin < size)
+                    b[i] = select(batch_bool_type::from_mask(first_lanes(size - begin)), load_partial<Arch>(data + begin, size - begin), padding);
+                else
+                    b[i] = padding;
+                b[i] = sort(b[i]);
+            }
+
+            for (std::size_t k = 2; k <= blocks; k *= 2)
+            {
+                for (std::size_t j = k / 2; j > 0; j /= 2)
+                {
+                    for (std::size_t i = 0; i < blocks; ++i)
+                    {
+                        std::size_t l = i ^ j;
+                        if (l <= i)
+                            continue;
+                        if ((i & k) == 0)
+                            merge(b[i], b[l]);
+                        else
+                            merge(b[l], b[i]);
+                    }
+                }
+            }
+
+            for (std::size_t i = 0; i * step < size; ++i)
+            {
+                std::size_t begin = i * step;
+                if (begin + step <= size)
+                    b[i].store_unaligned(data + begin);
+                else
+                    store_partial(data + begin, b[i], size - begin);
+            }
+        }
+
+        template <class T>
+        XSIMD_INLINE T median_of_three(T a, T b, T c) noexcept
+        {
+            if (b < a)
+                std::swap(a, b);
+            if (c < b)
+                b = (c < a) ? a : c;
+            return b;
+        }
+
+        // recursive, cannot be forcibly inlined
+        template <class Arch, class T>
+        inline void quick_sort(T* data, std::size_t size, std::size_t depth)
+        {
+            using batch_type = batch<T, Arch>;
+            constexpr std::size_t small_size = sort_blocks * batch_type::size;
+            while (size > small_size)
+            {
+                // too many unbalanced partitions, fall back to the standard
+                // sort to bound the complexity
+                if (depth == 0)
+                {
+                    std::sort(data, data + size);
+                    return;
+                }
+                --depth;
+
+                const batch_type pivot(median_of_three(data[0], data[size / 2], data[size - 1]));
+                auto less = [&pivot](batch_type const& x)
+                { return x < pivot; };
+                std::size_t split = partition_range<Arch>(data, size, less);
+                if (split == 0)
+                {
+                    // the pivot is the minimum: the elements equal to it
+                    // are already in their final place once moved first
+                    auto less_equal = [&pivot](batch_type const& x)
+                    { return x <= pivot; };
+                    split = partition_range<Arch>(data, size, less_equal);
+                    if (split == 0)
+                    {
+                        // NaN pivot
+                        std::sort(data, data + size);
+                        return;
+                    }
+                    data += split;
+                    size -= split;
+                    continue;
+                }
+
+                // recurse on the smallest part to bound the stack depth
+                if (split < size - split)
+                {
+                    quick_sort<Arch>(data, split, depth);
+                    data += split;
+                    size -= split;
+                }
+                else
+                {
+                    quick_sort<Arch>(data + split, size - split, depth);
+                    size = split;
+                }
+            }
+            if (size > 1)
+                sort_small<Arch>(data, size);
+        }
+
+        template <class Arch, class T>
+        XSIMD_INLINE void sort_range(T* data, std::size_t size, std::true_type)
+        {
+            std::size_t depth = 0;
+            for (std::size_t n = size; n > 1; n /= 2)
+                depth += 2;
+            quick_sort<Arch>(data, size, depth);
+        }
+
+        // no in register sorting network for these types
+        template <class Arch, class T>
+        XSIMD_INLINE void sort_range(T* data, std::size_t size, std::false_type)
+        {
+            std::sort(data, data + size);
+        }
+    }
+
+    /**
+     * @defgroup algorithms Range algorithms
+     */
+
+    /**
+     * @ingroup algorithms
+     *
+     * Applies \c f to the contiguous range [\c first, \c last) and stores the
+     * result in the range beginning at \c out_first. \c f is only called on
+     * batches of \c Arch: the body of the range is processed with aligned
+     * stores after a partial batch that peels the misaligned head, the
+     * remaining elements are processed with a partial batch. \c f must return
+     * a batch of the value type of \c out_first.
+     * @tparam Arch architecture used for the computation.
+     * @tparam Unroll number of batches processed per iteration of the main loop.
+     * @param first beginning of the input range
+     * @param last end of the input range
+     * @param out_first beginning of the output range
+     * @param f unary function taking and returning a batch
+     * @return iterator past the last element written
+     */
+    template <class Arch = default_arch, std::size_t Unroll = 4, class I1, class I2, class O, class UF, class = detail::enable_if_iterator_t<I1>>
+    XSIMD_INLINE O transform(I1 first, I2 last, O out_first, UF&& f)
+    {
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+            return out_first;
+        detail::transform_range<Arch, Unroll>(&*first, &*out_first, size, f, unaligned_mode {});
+        return std::next(out_first, size);
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Applies \c f to the pairs of elements of the contiguous ranges
+     * [\c first_1, \c last_1) and [\c first_2, ...) and stores the result in
+     * the range beginning at \c out_first. Same processing scheme as the
+     * unary \ref transform.
+     * @tparam Arch architecture used for the computation.
+     * @tparam Unroll number of batches processed per iteration of the main loop.
+     * @param first_1 beginning of the first input range
+     * @param last_1 end of the first input range
+     * @param first_2 beginning of the second input range
+     * @param out_first beginning of the output range
+     * @param f binary function taking two batches and returning a batch
+     * @return iterator past the last element written
+     */
+    template <class Arch = default_arch, std::size_t Unroll = 4, class I1, class I2, class I3, class O, class BF, class = detail::enable_if_iterator_t<I1>>
+    XSIMD_INLINE O transform(I1 first_1, I2 last_1, I3 first_2, O out_first, BF&& f)
+    {
+        std::size_t size = static_cast<std::size_t>(std::distance(first_1, last_1));
+        if (size == 0)
+            return out_first;
+        detail::transform_range<Arch, Unroll>(&*first_1, &*first_2, &*out_first, size, f, unaligned_mode {});
+        return std::next(out_first, size);
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Applies \c f to the elements of the container \c in and stores the
+     * result in the container \c out, which must be at least as large.
+     * When both containers use an aligned allocator, as reported by
+     * \c container_alignment_t, the alignment is not checked at runtime.
+     * @tparam Arch architecture used for the computation.
+     * @tparam Unroll number of batches processed per iteration of the main loop.
+     * @param in input container
+     * @param out output container
+     * @param f unary function taking and returning a batch
+     */
+    template <class Arch = default_arch, std::size_t Unroll = 4, class C1, class C2, class UF, class = detail::enable_if_container_t<C1>>
+    XSIMD_INLINE void transform(C1 const& in, C2& out, UF&& f)
+    {
+        assert(out.size() >= in.size() && "output container is too small");
+        using mode = detail::common_alignment_t<container_alignment_t<C1>, container_alignment_t<C2>>;
+        if (in.size() != 0)
+            detail::transform_range<Arch, Unroll>(in.data(), out.data(), in.size(), f, mode {});
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Applies \c f to the pairs of elements of the containers \c in_1 and
+     * \c in_2 and stores the result in the container \c out.
+     * @tparam Arch architecture used for the computation.
+     * @tparam Unroll number of batches processed per iteration of the main loop.
+     * @param in_1 first input container
+     * @param in_2 second input container
+     * @param out output container
+     * @param f binary function taking two batches and returning a batch
+     */
+    template <class Arch = default_arch, std::size_t Unroll = 4, class C1, class C2, class C3, class BF, class = detail::enable_if_container_t<C1>>
+    XSIMD_INLINE void transform(C1 const& in_1, C2 const& in_2, C3& out, BF&& f)
+    {
+        assert(in_2.size() >= in_1.size() && out.size() >= in_1.size() && "containers are too small");
+        using mode = detail::common_alignment_t<detail::common_alignment_t<container_alignment_t<C1>, container_alignment_t<C2>>,
+                                                container_alignment_t<C3>>;
+        if (in_1.size() != 0)
+            detail::transform_range<Arch, Unroll>(in_1.data(), in_2.data(), out.data(), in_1.size(), f, mode {});
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Reduces the contiguous range [\c first, \c last) with the associative
+     * and commutative operation \c op, starting from \c init. Elements are
+     * not combined in order: \c Unroll accumulator batches are reduced
+     * independently, then together, and the result is finally combined
+     * with \c init.
+     * @tparam Arch architecture used for the computation.
+     * @tparam Unroll number of batches processed per iteration of the main loop.
+     * @param first beginning of the input range
+     * @param last end of the input range
+     * @param init initial value of the reduction
+     * @param op binary function accepting both batches and scalars, defaults to addition
+     * @return the result of the reduction
+     */
+    template <class Arch = default_arch, std::size_t Unroll = 4, class I1, class I2, class Init, class BF = detail::plus, class = detail::enable_if_iterator_t<I1>>
+    XSIMD_INLINE Init reduce(I1 first, I2 last, Init init, BF&& op = BF())
+    {
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+            return init;
+        return detail::reduce_range<Arch, Unroll>(&*first, size, init, op, unaligned_mode {});
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Reduces the elements of the container \c in with \c op, starting from
+     * \c init. When the container uses an aligned allocator, as reported by
+     * \c container_alignment_t, the alignment is not checked at runtime.
+     * @tparam Arch architecture used for the computation.
+     * @tparam Unroll number of batches processed per iteration of the main loop.
+     * @param in input container
+     * @param init initial value of the reduction
+     * @param op binary function accepting both batches and scalars, defaults to addition
+     * @return the result of the reduction
+     */
+    template <class Arch = default_arch, std::size_t Unroll = 4, class C, class Init, class BF = detail::plus, class = detail::enable_if_container_t<C>>
+    XSIMD_INLINE Init reduce(C const& in, Init init, BF&& op = BF())
+    {
+        if (in.size() == 0)
+            return init;
+        return detail::reduce_range<Arch, Unroll>(in.data(), in.size(), init, op, container_alignment_t<C> {});
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Computes the inclusive prefix sums of the contiguous range
+     * [\c first, \c last) plus \c init and stores them in the range
+     * beginning at \c out_first: the i-th output is \c init plus the sum of
+     * the first i + 1 inputs. Each batch is scanned with \ref prefix_sum and
+     * the running total is carried to the next batch. The output range may be
+     * the input range.
+     * @tparam Arch architecture used for the computation.
+     * @param first beginning of the input range
+     * @param last end of the input range
+     * @param out_first beginning of the output range
+     * @param init value added to every prefix sum
+     * @return iterator past the last element written
+     */
+    template <class Arch = default_arch, class I1, class I2, class O, class T, class = detail::enable_if_iterator_t<I1>>
+    XSIMD_INLINE O inclusive_scan(I1 first, I2 last, O out_first, T init)
+    {
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+            return out_first;
+        using value_type = typename std::decay<decltype(*first)>::type;
+        detail::scan_range<Arch>(&*first, &*out_first, size, static_cast<value_type>(init));
+        return std::next(out_first, size);
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Computes the inclusive prefix sums of the contiguous range
+     * [\c first, \c last) and stores them in the range beginning at
+     * \c out_first.
+     * @tparam Arch architecture used for the computation.
+     * @param first beginning of the input range
+     * @param last end of the input range
+     * @param out_first beginning of the output range
+     * @return iterator past the last element written
+     */
+    template <class Arch = default_arch, class I1, class I2, class O, class = detail::enable_if_iterator_t<I1>>
+    XSIMD_INLINE O inclusive_scan(I1 first, I2 last, O out_first)
+    {
+        using value_type = typename std::decay<decltype(*first)>::type;
+        return inclusive_scan<Arch>(first, last, out_first, value_type(0));
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Computes the exclusive prefix sums of the contiguous range
+     * [\c first, \c last) starting from \c init and stores them in the
+     * range beginning at \c out_first: the i-th output is \c init plus the
+     * sum of the first i inputs. The output range may be the input range.
+     * @tparam Arch architecture used for the computation.
+     * @param first beginning of the input range
+     * @param last end of the input range
+     * @param out_first beginning of the output range
+     * @param init first output, added to every prefix sum
+     * @return iterator past the last element written
+     */
+    template <class Arch = default_arch, class I1, class I2, class O, class T, class = detail::enable_if_iterator_t<I1>>
+    XSIMD_INLINE O exclusive_scan(I1 first, I2 last, O out_first, T init)
+    {
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+            return out_first;
+        using value_type = typename std::decay<decltype(*first)>::type;
+        value_type* out = &*out_first;
+        // out[i + 1] is the inclusive scan of in[i], out[0] is written last
+        // as it may alias in[0]
+        if (size > 1)
+            detail::scan_range<Arch>(&*first, out + 1, size - 1, static_cast<value_type>(init));
+        out[0] = static_cast<value_type>(init);
+        return std::next(out_first, size);
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Finds the smallest element of the contiguous range [\c first, \c last)
+     * in a single pass. Ties are resolved to the first occurrence, as in
+     * \c std::min_element. The result is unspecified if the range contains
+     * NaN.
+     * @tparam Arch architecture used for the computation.
+     * @param first beginning of the range
+     * @param last end of the range
+     * @return iterator to the smallest element, \c first if the range is empty
+     */
+    template <class Arch = default_arch, class I1, class I2, class = detail::enable_if_iterator_t<I1>>
+    XSIMD_INLINE I1 min_element(I1 first, I2 last)
+    {
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+            return first;
+        using value_type = typename std::decay<decltype(*first)>::type;
+        detail::extremum<Arch, value_type, detail::min_first> min_e(*first);
+        detail::extremum_range<Arch>(&*first, size, min_e);
+        return std::next(first, min_e.pos);
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Finds the greatest element of the contiguous range [\c first, \c last)
+     * in a single pass. Ties are resolved to the first occurrence, as in
+     * \c std::max_element. The result is unspecified if the range contains
+     * NaN.
+     * @tparam Arch architecture used for the computation.
+     * @param first beginning of the range
+     * @param last end of the range
+     * @return iterator to the greatest element, \c first if the range is empty
+     */
+    template <class Arch = default_arch, class I1, class I2, class = detail::enable_if_iterator_t<I1>>
+    XSIMD_INLINE I1 max_element(I1 first, I2 last)
+    {
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+            return first;
+        using value_type = typename std::decay<decltype(*first)>::type;
+        detail::extremum<Arch, value_type, detail::max_first> max_e(*first);
+        detail::extremum_range<Arch>(&*first, size, max_e);
+        return std::next(first, max_e.pos);
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Finds the smallest and the greatest elements of the contiguous range
+     * [\c first, \c last) in a single pass. As in \c std::minmax_element,
+     * the first smallest and the last greatest elements are returned. The
+     * result is unspecified if the range contains NaN.
+     * @tparam Arch architecture used for the computation.
+     * @param first beginning of the range
+     * @param last end of the range
+     * @return pair of iterators to the smallest and the greatest elements,
+     * both \c first if the range is empty
+     */
+    template <class Arch = default_arch, class I1, class I2, class = detail::enable_if_iterator_t<I1>>
+    XSIMD_INLINE std::pair<I1, I1> minmax_element(I1 first, I2 last)
+    {
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+            return { first, first };
+        using value_type = typename std::decay<decltype(*first)>::type;
+        detail::extremum<Arch, value_type, detail::min_first> min_e(*first);
+        detail::extremum<Arch, value_type, detail::max_last> max_e(*first);
+        detail::extremum_range<Arch>(&*first, size, min_e, max_e);
+        return { std::next(first, min_e.pos), std::next(first, max_e.pos) };
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Copies the elements of the contiguous range [\c first, \c last) for
+     * which \c pred holds to the contiguous range starting at \c out_first,
+     * preserving their order. \c pred is called on batches and returns the
+     * batch_bool of the selected lanes; the selected elements are written
+     * with \ref compress_store. \c out_first may be equal to \c first.
+     * @tparam Arch architecture used for the computation.
+     * @param first beginning of the input range
+     * @param last end of the input range
+     * @param out_first beginning of the output range
+     * @param pred batch predicate
+     * @return the end of the output range
+     */
+    template <class Arch = default_arch, class I1, class I2, class O, class P, class = detail::enable_if_iterator_t<I1>>
+    XSIMD_INLINE O copy_if(I1 first, I2 last, O out_first, P&& pred)
+    {
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+            return out_first;
+        std::size_t written = detail::copy_if_range<Arch>(&*first, &*out_first, size, pred);
+        return std::next(out_first, written);
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Reorders the contiguous range [\c first, \c last) so that the elements
+     * for which \c pred holds precede the others. \c pred is called on
+     * batches and returns the batch_bool of the selected lanes. The
+     * partition is done in place with \ref compress_store and is not
+     * stable.
+     * @tparam Arch architecture used for the computation.
+     * @param first beginning of the range
+     * @param last end of the range
+     * @param pred batch predicate
+     * @return an iterator to the first element of the second group
+     */
+    template <class Arch = default_arch, class I1, class I2, class P, class = detail::enable_if_iterator_t<I1>>
+    XSIMD_INLINE I1 partition(I1 first, I2 last, P&& pred)
+    {
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size == 0)
+            return first;
+        return std::next(first, detail::partition_range<Arch>(&*first, size, pred));
+    }
+
+    /**
+     * @ingroup algorithms
+     *
+     * Sorts the contiguous range [\c first, \c last) in ascending order
+     * with a vectorized quicksort: the range is partitioned in place with
+     * \ref compress_store, and ranges of a few batches are sorted in registers
+     * with \ref sort and \ref merge. The sort is not stable. Ranges of 8
+     * and 16 bit elements are sorted with \c std::sort. The result is
+     * unspecified if the range contains NaN.
+     * @tparam Arch architecture used for the computation.
+     * @param first beginning of the range
+     * @param last end of the range
+     */
+    template <class Arch = default_arch, class I1, class I2, class = detail::enable_if_iterator_t<I1>>
+    XSIMD_INLINE void sort(I1 first, I2 last)
+    {
+        std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+        if (size < 2)
+            return;
+        using value_type = typename std::decay<decltype(*first)>::type;
+        detail::sort_range<Arch>(&*first, size, std::integral_constant<bool, (sizeof(value_type) == 4 || sizeof(value_type) == 8)>());
+    }
+}
+
+#endif
+
+#endif
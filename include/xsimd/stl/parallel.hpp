@@ -0,0 +1,568 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#ifndef XSIMD_PARALLEL_HPP
+#define XSIMD_PARALLEL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "./algorithms.hpp"
+
+#ifndef XSIMD_NO_SUPPORTED_ARCHITECTURE
+
+/**
+ * @ingroup xsimd_config_macro
+ *
+ * Size in bytes of the blocks of a range processed by a single task of the
+ * parallel algorithms. Defaults to a size that keeps the working set of a
+ * task within the L2 cache.
+ */
+#ifndef XSIMD_PARALLEL_BLOCK_SIZE
+#define XSIMD_PARALLEL_BLOCK_SIZE 65536
+#endif
+
+namespace xsimd
+{
+    namespace parallel
+    {
+        /**
+         * @ingroup algorithms
+         *
+         * Fixed size pool of threads running bulk jobs. The tasks of a job
+         * are spread evenly over per-thread queues, each thread consumes its
+         * own queue from the front and steals from the back of the others
+         * once it is empty. The calling thread takes part in the job.
+         *
+         * A job submitted from a task of a job already running is executed
+         * sequentially by the submitting thread.
+         */
+        class thread_pool
+        {
+        public:
+            explicit thread_pool(std::size_t concurrency = std::thread::hardware_concurrency());
+            ~thread_pool();
+
+            thread_pool(thread_pool const&) = delete;
+            thread_pool& operator=(thread_pool const&) = delete;
+
+            std::size_t concurrency() const noexcept;
+
+            template <class F>
+            void bulk_execute(std::size_t count, F&& f);
+
+        private:
+            struct task_queue
+            {
+                std::mutex mutex;
+                std::size_t begin = 0;
+                std::size_t end = 0;
+                // keeps the queues of different threads on different cache lines
+                char padding[64];
+            };
+
+            bool pop(std::size_t queue, std::size_t& task);
+            bool steal(std::size_t thief, std::size_t& task);
+            void run_tasks(std::size_t queue);
+            void worker_loop(std::size_t queue);
+
+            std::size_t m_queue_count;
+            std::unique_ptr<task_queue[]> m_queues;
+            std::vector<std::thread> m_workers;
+
+            std::mutex m_submit_mutex;
+            std::mutex m_mutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_done;
+            std::size_t m_generation = 0;
+            std::size_t m_active = 0;
+            bool m_stop = false;
+
+            void (*m_invoke)(void*, std::size_t) = nullptr;
+            void* m_context = nullptr;
+#if defined(_CPPUNWIND) || defined(__cpp_exceptions)
+            std::exception_ptr m_exception;
+#endif
+        };
+
+        /**
+         * @ingroup algorithms
+         *
+         * Returns the pool used by the parallel algorithms when no executor
+         * is given, created on first use with one thread per hardware thread.
+         */
+        XSIMD_INLINE thread_pool& default_thread_pool()
+        {
+            static thread_pool pool;
+            return pool;
+        }
+    }
+
+    namespace detail
+    {
+        // pool whose tasks the current thread is running, if any
+        XSIMD_INLINE parallel::thread_pool const*& current_thread_pool() noexcept
+        {
+            static thread_local parallel::thread_pool const* pool = nullptr;
+            return pool;
+        }
+
+        class current_thread_pool_guard
+        {
+        public:
+            XSIMD_INLINE explicit current_thread_pool_guard(parallel::thread_pool const* pool) noexcept
+                : m_previous(current_thread_pool())
+            {
+                current_thread_pool() = pool;
+            }
+
+            XSIMD_INLINE ~current_thread_pool_guard()
+            {
+                current_thread_pool() = m_previous;
+            }
+
+        private:
+            parallel::thread_pool const* m_previous;
+        };
+
+        template <class E>
+        using enable_if_executor_t = void_t<decltype(std::declval<E const&>().concurrency())>;
+
+        // Filters ArchList, keeping the architectures that provide batches
+        // of T, such as neon for double.
+        template <class T, class L, class ArchList>
+        struct archs_for_helper;
+
+        template <class T, class L>
+        struct archs_for_helper<T, L, arch_list<>>
+        {
+            using type = L;
+        };
+
+        template <class T, class L, class Arch, class... Archs>
+        struct archs_for_helper<T, L, arch_list<Arch, Archs...>>
+            : archs_for_helper<T,
+                               typename std::conditional<types::has_simd_register<T, Arch>::value,
+                                                         typename L::template add<Arch>, L>::type,
+                               arch_list<Archs...>>
+        {
+        };
+
+        template <class T, class ArchList>
+        using archs_for_t = typename archs_for_helper<T, arch_list<>, ArchList>::type;
+
+        // Splits [0, size) in blocks of about XSIMD_PARALLEL_BLOCK_SIZE bytes.
+        // The first block absorbs the elements preceding the first aligned
+        // address of ptr so that every other block starts aligned.
+        struct block_partition
+        {
+            std::size_t head;
+            std::size_t block;
+            std::size_t size;
+
+            XSIMD_INLINE std::size_t count() const noexcept
+            {
+                return size <= head + block ? 1 : 1 + (size - head - 1) / block;
+            }
+
+            XSIMD_INLINE std::size_t begin(std::size_t i) const noexcept
+            {
+                return i == 0 ? 0 : head + i * block;
+            }
+
+            XSIMD_INLINE std::size_t end(std::size_t i) const noexcept
+            {
+                return std::min(head + (i + 1) * block, size);
+            }
+        };
+
+        template <class Arch, class T>
+        XSIMD_INLINE block_partition make_block_partition(T const* ptr, std::size_t size) noexcept
+        {
+            constexpr std::size_t step = batch<T, Arch>::size;
+            std::size_t block = std::max<std::size_t>(XSIMD_PARALLEL_BLOCK_SIZE / (sizeof(T) * step), 1) * step;
+            return { alignment_head<Arch>(ptr, size, unaligned_mode {}), block, size };
+        }
+
+        template <std::size_t Unroll, class Executor, class T, class U, class F>
+        struct parallel_transform_job
+        {
+            Executor& executor;
+            T const* in;
+            U* out;
+            std::size_t size;
+            F& f;
+
+            template <class Arch>
+            XSIMD_INLINE void operator()(Arch) const
+            {
+                block_partition partition = make_block_partition<Arch>(out, size);
+                executor.bulk_execute(partition.count(), [this, &partition](std::size_t i)
+                                      {
+                    std::size_t b = partition.begin(i), e = partition.end(i);
+                    xsimd::transform<Arch, Unroll>(in + b, in + e, out + b, f); });
+            }
+        };
+
+        template <std::size_t Unroll, class Executor, class T1, class T2, class U, class F>
+        struct parallel_binary_transform_job
+        {
+            Executor& executor;
+            T1 const* in1;
+            T2 const* in2;
+            U* out;
+            std::size_t size;
+            F& f;
+
+            template <class Arch>
+            XSIMD_INLINE void operator()(Arch) const
+            {
+                block_partition partition = make_block_partition<Arch>(out, size);
+                executor.bulk_execute(partition.count(), [this, &partition](std::size_t i)
+                                      {
+                    std::size_t b = partition.begin(i), e = partition.end(i);
+                    xsimd::transform<Arch, Unroll>(in1 + b, in1 + e, in2 + b, out + b, f); });
+            }
+        };
+
+        template <std::size_t Unroll, class Executor, class T, class F>
+        struct parallel_reduce_job
+        {
+            Executor& executor;
+            T const* in;
+            std::size_t size;
+            F& op;
+            std::vector<T>& partials;
+
+            template <class Arch>
+            XSIMD_INLINE void operator()(Arch) const
+            {
+                block_partition partition = make_block_partition<Arch>(in, size);
+                partials.resize(partition.count());
+                // each block is seeded with its first element, so that op
+                // needs no identity element
+                executor.bulk_execute(partition.count(), [this, &partition](std::size_t i)
+                                      {
+                    std::size_t b = partition.begin(i), e = partition.end(i);
+                    partials[i] = xsimd::reduce<Arch, Unroll>(in + b + 1, in + e, in[b], op); });
+            }
+        };
+    }
+
+    namespace parallel
+    {
+        /******************************
+         * thread_pool implementation *
+         ******************************/
+
+        XSIMD_INLINE thread_pool::thread_pool(std::size_t concurrency)
+            : m_queue_count(std::max<std::size_t>(concurrency, 1))
+            , m_queues(new task_queue[m_queue_count])
+        {
+            // queue 0 belongs to the submitting thread. If a worker cannot be
+            // created, its queue is drained by the other threads.
+            for (std::size_t i = 1; i < m_queue_count; ++i)
+            {
+#if defined(_CPPUNWIND) || defined(__cpp_exceptions)
+                try
+                {
+                    m_workers.emplace_back(&thread_pool::worker_loop, this, i);
+                }
+                catch (std::system_error const&)
+                {
+                    break;
+                }
+#else
+                m_workers.emplace_back(&thread_pool::worker_loop, this, i);
+#endif
+            }
+        }
+
+        XSIMD_INLINE thread_pool::~thread_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+            for (auto& worker : m_workers)
+                worker.join();
+        }
+
+        /**
+         * Number of threads running the jobs, including the calling thread.
+         */
+        XSIMD_INLINE std::size_t thread_pool::concurrency() const noexcept
+        {
+            return m_workers.size() + 1;
+        }
+
+        /**
+         * Calls \c f(i) for every \c i in [0, \c count) and returns once all
+         * the calls are done. The first exception thrown by \c f is rethrown
+         * in the calling thread when exceptions are enabled.
+         */
+        template <class F>
+        XSIMD_INLINE void thread_pool::bulk_execute(std::size_t count, F&& f)
+        {
+            using functor_type = typename std::remove_reference<F>::type;
+            if (count == 0)
+                return;
+            if (count == 1 || m_workers.empty() || detail::current_thread_pool() != nullptr)
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    f(i);
+                return;
+            }
+
+            std::lock_guard<std::mutex> submit(m_submit_mutex);
+            for (std::size_t q = 0; q < m_queue_count; ++q)
+            {
+                std::lock_guard<std::mutex> lock(m_queues[q].mutex);
+                m_queues[q].begin = q * count / m_queue_count;
+                m_queues[q].end = (q + 1) * count / m_queue_count;
+            }
+            m_context = const_cast<void*>(static_cast<void const*>(std::addressof(f)));
+            m_invoke = [](void* context, std::size_t i)
+            { (*static_cast<functor_type*>(context))(i); };
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+#if defined(_CPPUNWIND) || defined(__cpp_exceptions)
+                m_exception = nullptr;
+#endif
+                m_active = m_workers.size();
+                ++m_generation;
+            }
+            m_wake.notify_all();
+
+            run_tasks(0);
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [this]
+                        { return m_active == 0; });
+#if defined(_CPPUNWIND) || defined(__cpp_exceptions)
+            if (m_exception)
+            {
+                std::exception_ptr exception = m_exception;
+                m_exception = nullptr;
+                std::rethrow_exception(exception);
+            }
+#endif
+        }
+
+        XSIMD_INLINE bool thread_pool::pop(std::size_t queue, std::size_t& task)
+        {
+            std::lock_guard<std::mutex> lock(m_queues[queue].mutex);
+            if (m_queues[queue].begin == m_queues[queue].end)
+                return false;
+            task = m_queues[queue].begin++;
+            return true;
+        }
+
+        XSIMD_INLINE bool thread_pool::steal(std::size_t thief, std::size_t& task)
+        {
+            for (std::size_t i = 1; i < m_queue_count; ++i)
+            {
+                task_queue& victim = m_queues[(thief + i) % m_queue_count];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (victim.begin != victim.end)
+                {
+                    task = --victim.end;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        XSIMD_INLINE void thread_pool::run_tasks(std::size_t queue)
+        {
+            detail::current_thread_pool_guard guard(this);
+            std::size_t task;
+            while (pop(queue, task) || steal(queue, task))
+            {
+#if defined(_CPPUNWIND) || defined(__cpp_exceptions)
+                try
+                {
+                    m_invoke(m_context, task);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (!m_exception)
+                        m_exception = std::current_exception();
+                }
+#else
+                m_invoke(m_context, task);
+#endif
+            }
+        }
+
+        XSIMD_INLINE void thread_pool::worker_loop(std::size_t queue)
+        {
+            std::size_t generation = 0;
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_wake.wait(lock, [this, generation]
+                                { return m_stop || m_generation != generation; });
+                    if (m_stop)
+                        return;
+                    generation = m_generation;
+                }
+                run_tasks(queue);
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (--m_active == 0)
+                        m_done.notify_one();
+                }
+            }
+        }
+
+        /***********************
+         * parallel algorithms *
+         ***********************/
+
+        /**
+         * @ingroup algorithms
+         *
+         * Parallel version of \ref xsimd::transform. The range is split in
+         * blocks of about \c XSIMD_PARALLEL_BLOCK_SIZE bytes, aligned on the
+         * output, that are processed by the tasks of \c executor. The
+         * architecture is resolved once with \ref xsimd::dispatch among
+         * \c ArchList, so \c f must accept batches of each of them, and
+         * must not throw.
+         * @tparam ArchList architectures to dispatch on.
+         * @tparam Unroll number of batches processed per iteration of the main loop.
+         * @param executor object providing \c concurrency() and
+         * \c bulk_execute(count, f), such as a \ref thread_pool
+         * @param first beginning of the input range
+         * @param last end of the input range
+         * @param out_first beginning of the output range
+         * @param f unary function taking and returning a batch
+         * @return iterator past the last element written
+         */
+        template <class ArchList = supported_architectures, std::size_t Unroll = 4, class Executor, class I1, class I2, class O, class UF, class = detail::enable_if_executor_t<Executor>>
+        XSIMD_INLINE O transform(Executor& executor, I1 first, I2 last, O out_first, UF&& f)
+        {
+            std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+            if (size == 0)
+                return out_first;
+            using value_type = typename std::decay<decltype(*first)>::type;
+            using result_type = typename std::decay<decltype(*out_first)>::type;
+            using arch_list_type = detail::archs_for_t<result_type, detail::archs_for_t<value_type, ArchList>>;
+            using job_type = detail::parallel_transform_job<Unroll, Executor, value_type, result_type, UF>;
+            xsimd::dispatch<arch_list_type>(job_type { executor, &*first, &*out_first, size, f })();
+            return std::next(out_first, size);
+        }
+
+        /**
+         * @ingroup algorithms
+         *
+         * Parallel version of \ref xsimd::transform running on the
+         * \ref default_thread_pool.
+         */
+        template <class ArchList = supported_architectures, std::size_t Unroll = 4, class I1, class I2, class O, class UF, class = detail::enable_if_iterator_t<I1>>
+        XSIMD_INLINE O transform(I1 first, I2 last, O out_first, UF&& f)
+        {
+            return parallel::transform<ArchList, Unroll>(default_thread_pool(), first, last, out_first, f);
+        }
+
+        /**
+         * @ingroup algorithms
+         *
+         * Parallel version of the binary \ref xsimd::transform, see the
+         * unary version for the requirements on \c executor and \c f.
+         */
+        template <class ArchList = supported_architectures, std::size_t Unroll = 4, class Executor, class I1, class I2, class I3, class O, class BF, class = detail::enable_if_executor_t<Executor>>
+        XSIMD_INLINE O transform(Executor& executor, I1 first_1, I2 last_1, I3 first_2, O out_first, BF&& f)
+        {
+            std::size_t size = static_cast<std::size_t>(std::distance(first_1, last_1));
+            if (size == 0)
+                return out_first;
+            using value_type_1 = typename std::decay<decltype(*first_1)>::type;
+            using value_type_2 = typename std::decay<decltype(*first_2)>::type;
+            using result_type = typename std::decay<decltype(*out_first)>::type;
+            using arch_list_type = detail::archs_for_t<result_type, detail::archs_for_t<value_type_2, detail::archs_for_t<value_type_1, ArchList>>>;
+            using job_type = detail::parallel_binary_transform_job<Unroll, Executor, value_type_1, value_type_2, result_type, BF>;
+            xsimd::dispatch<arch_list_type>(job_type { executor, &*first_1, &*first_2, &*out_first, size, f })();
+            return std::next(out_first, size);
+        }
+
+        /**
+         * @ingroup algorithms
+         *
+         * Parallel version of the binary \ref xsimd::transform running on
+         * the \ref default_thread_pool.
+         */
+        template <class ArchList = supported_architectures, std::size_t Unroll = 4, class I1, class I2, class I3, class O, class BF, class = detail::enable_if_iterator_t<I1>>
+        XSIMD_INLINE O transform(I1 first_1, I2 last_1, I3 first_2, O out_first, BF&& f)
+        {
+            return parallel::transform<ArchList, Unroll>(default_thread_pool(), first_1, last_1, first_2, out_first, f);
+        }
+
+        /**
+         * @ingroup algorithms
+         *
+         * Parallel version of \ref xsimd::reduce. Each block of the range is
+         * reduced by a task of \c executor, the partial results are then
+         * combined with \c init in the order of the blocks. The blocks only
+         * depend on the range and its alignment, so the result does not
+         * depend on the number of threads or on their scheduling.
+         * @tparam ArchList architectures to dispatch on.
+         * @tparam Unroll number of batches processed per iteration of the main loop.
+         * @param executor object providing \c concurrency() and
+         * \c bulk_execute(count, f), such as a \ref thread_pool
+         * @param first beginning of the input range
+         * @param last end of the input range
+         * @param init initial value of the reduction
+         * @param op binary function accepting both batches and scalars, defaults to addition
+         * @return the result of the reduction
+         */
+        template <class ArchList = supported_architectures, std::size_t Unroll = 4, class Executor, class I1, class I2, class Init, class BF = detail::plus, class = detail::enable_if_executor_t<Executor>>
+        XSIMD_INLINE Init reduce(Executor& executor, I1 first, I2 last, Init init, BF&& op = BF())
+        {
+            using value_type = typename std::decay<decltype(*first)>::type;
+            std::size_t size = static_cast<std::size_t>(std::distance(first, last));
+            if (size == 0)
+                return init;
+            std::vector<value_type> partials;
+            using job_type = detail::parallel_reduce_job<Unroll, Executor, value_type, typename std::remove_reference<BF>::type>;
+            xsimd::dispatch<detail::archs_for_t<value_type, ArchList>>(job_type { executor, &*first, size, op, partials })();
+            for (value_type const& partial : partials)
+                init = static_cast<Init>(op(init, partial));
+            return init;
+        }
+
+        /**
+         * @ingroup algorithms
+         *
+         * Parallel version of \ref xsimd::reduce running on the
+         * \ref default_thread_pool.
+         */
+        template <class ArchList = supported_architectures, std::size_t Unroll = 4, class I1, class I2, class Init, class BF = detail::plus, class = detail::enable_if_iterator_t<I1>>
+        XSIMD_INLINE Init reduce(I1 first, I2 last, Init init, BF&& op = BF())
+        {
+            return parallel::reduce<ArchList, Unroll>(default_thread_pool(), first, last, init, op);
+        }
+    }
+}
+
+#endif
+
+#endif
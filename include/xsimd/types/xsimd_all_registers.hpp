@@ -25,6 +25,7 @@
 #include "xsimd_avx512vnni_avx512bw_register.hpp"
 #include "xsimd_avx512vnni_avx512vbmi_register.hpp"
 
+#include "xsimd_avx512bf16_register.hpp"
 #include "xsimd_avx512ifma_register.hpp"
 #include "xsimd_avx512vbmi_register.hpp"
 
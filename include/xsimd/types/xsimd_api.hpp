@@ -12,6 +12,8 @@
 #ifndef XSIMD_API_HPP
 #define XSIMD_API_HPP
 
+#include <array>
+#include <cassert>
 #include <complex>
 #include <cstddef>
 #include <limits>
@@ -19,6 +21,8 @@
 
 #include "../arch/xsimd_isa.hpp"
 #include "../types/xsimd_batch.hpp"
+#include "../types/xsimd_bfloat16.hpp"
+#include "../types/xsimd_float16.hpp"
 #include "../types/xsimd_traits.hpp"
 
 namespace xsimd
@@ -263,6 +267,26 @@ namespace xsimd
         return kernel::batch_cast<A>(x, batch<T_out, A> {}, A {});
     }
 
+    /**
+     * @ingroup batch_arithmetic
+     *
+     * Computes the dot product of each pair of adjacent bfloat16 slots of
+     * \c x and \c y, widened to single precision, and adds it to the
+     * corresponding slot of \c acc. Products are exact, the odd slot of
+     * each pair is accumulated before the even one.
+     * @param acc batch of single precision accumulators.
+     * @param x batch of \ref bfloat16.
+     * @param y batch of \ref bfloat16.
+     * @return the updated accumulators.
+     */
+    template <class A>
+    XSIMD_INLINE batch<float, A> bf16_dot(batch<float, A> const& acc, batch<bfloat16, A> const& x, batch<bfloat16, A> const& y) noexcept
+    {
+        detail::static_check_supported_config<float, A>();
+        detail::static_check_supported_config<bfloat16, A>();
+        return kernel::bf16_dot<A>(acc, x, y, A {});
+    }
+
     /**
      * @ingroup batch_miscellaneous
      *
@@ -573,6 +597,38 @@ namespace xsimd
         return kernel::compress<A>(x, mask, A {});
     }
 
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Stores the elements of batch \c x selected by \c mask contiguously
+     * to \c mem, in order. Only the selected elements are written.
+     * @param mem the memory buffer to write to
+     * @param x the batch to pack
+     * @param mask the selection of the elements to write
+     * @return the number of elements written.
+     */
+    template <class T, class A>
+    XSIMD_INLINE std::size_t compress_store(T* mem, batch<T, A> const& x, batch_bool<T, A> const& mask) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        return kernel::compress_store<A>(mem, x, mask, A {});
+    }
+
+    /**
+     * @ingroup batch_miscellaneous
+     *
+     * Detects duplicated values within the batch \c x. Bit \c j of slot \c i
+     * of the result is set if \c j < \c i and <tt>x[j] == x[i]</tt>.
+     * @param x batch of 32 or 64 bit integers.
+     * @return batch of bitmasks of the previous slots holding the same value.
+     */
+    template <class T, class A>
+    XSIMD_INLINE batch<T, A> conflict(batch<T, A> const& x) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        return kernel::conflict<A>(x, A {});
+    }
+
     /**
      * @ingroup batch_complex
      *
@@ -676,6 +732,43 @@ namespace xsimd
         return x / y;
     }
 
+    /**
+     * @ingroup batch_arithmetic
+     *
+     * Computes the dot product of each group of four adjacent 8-bit
+     * slots of \c x and \c y, and adds it to the corresponding 32-bit slot
+     * of \c acc. Intermediate products do not saturate.
+     * @param acc batch of 32-bit accumulators.
+     * @param x batch of unsigned 8-bit integers.
+     * @param y batch of signed 8-bit integers.
+     * @return the updated accumulators.
+     */
+    template <class A>
+    XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<uint8_t, A> const& x, batch<int8_t, A> const& y) noexcept
+    {
+        detail::static_check_supported_config<int32_t, A>();
+        detail::static_check_supported_config<uint8_t, A>();
+        return kernel::dot_accumulate<A>(acc, x, y, A {});
+    }
+
+    /**
+     * @ingroup batch_arithmetic
+     *
+     * Computes the dot product of each pair of adjacent 16-bit slots of
+     * \c x and \c y, and adds it to the corresponding 32-bit slot of \c acc.
+     * @param acc batch of 32-bit accumulators.
+     * @param x batch of signed 16-bit integers.
+     * @param y batch of signed 16-bit integers.
+     * @return the updated accumulators.
+     */
+    template <class A>
+    XSIMD_INLINE batch<int32_t, A> dot_accumulate(batch<int32_t, A> const& acc, batch<int16_t, A> const& x, batch<int16_t, A> const& y) noexcept
+    {
+        detail::static_check_supported_config<int32_t, A>();
+        detail::static_check_supported_config<int16_t, A>();
+        return kernel::dot_accumulate<A>(acc, x, y, A {});
+    }
+
     /**
      * @ingroup batch_logical
      *
@@ -1280,6 +1373,22 @@ namespace xsimd
         return simd_return_type<bool, To, A>::load_aligned(ptr);
     }
 
+    template <class To, class A = default_arch>
+    XSIMD_INLINE batch<To, A> load_as(float16 const* ptr, aligned_mode) noexcept
+    {
+        static_assert(std::is_same<To, float>::value, "half precision values can only be loaded as float");
+        detail::static_check_supported_config<To, A>();
+        return kernel::load_aligned<A>(ptr, kernel::convert<To> {}, A {});
+    }
+
+    template <class To, class A = default_arch>
+    XSIMD_INLINE batch<To, A> load_as(bfloat16 const* ptr, aligned_mode) noexcept
+    {
+        static_assert(std::is_same<To, float>::value, "bfloat16 values can only be loaded as float");
+        detail::static_check_supported_config<To, A>();
+        return kernel::load_aligned<A>(ptr, kernel::convert<To> {}, A {});
+    }
+
     template <class To, class A = default_arch, class From>
     XSIMD_INLINE simd_return_type<std::complex<From>, To, A> load_as(std::complex<From> const* ptr, aligned_mode) noexcept
     {
@@ -1321,6 +1430,22 @@ namespace xsimd
         return simd_return_type<bool, To, A>::load_unaligned(ptr);
     }
 
+    template <class To, class A = default_arch>
+    XSIMD_INLINE batch<To, A> load_as(float16 const* ptr, unaligned_mode) noexcept
+    {
+        static_assert(std::is_same<To, float>::value, "half precision values can only be loaded as float");
+        detail::static_check_supported_config<To, A>();
+        return kernel::load_unaligned<A>(ptr, kernel::convert<To> {}, A {});
+    }
+
+    template <class To, class A = default_arch>
+    XSIMD_INLINE batch<To, A> load_as(bfloat16 const* ptr, unaligned_mode) noexcept
+    {
+        static_assert(std::is_same<To, float>::value, "bfloat16 values can only be loaded as float");
+        detail::static_check_supported_config<To, A>();
+        return kernel::load_unaligned<A>(ptr, kernel::convert<To> {}, A {});
+    }
+
     template <class To, class A = default_arch, class From>
     XSIMD_INLINE simd_return_type<std::complex<From>, To, A> load_as(std::complex<From> const* ptr, unaligned_mode) noexcept
     {
@@ -1385,6 +1510,138 @@ namespace xsimd
         return load_as<From, A>(ptr, aligned_mode {});
     }
 
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Creates a batch from the buffer \c ptr, reading only the slots
+     * selected by \c mask. Other slots are set to zero and their memory is
+     * never accessed, so \c ptr may point close to the end of a mapping.
+     * The memory does not need to be aligned.
+     * @param ptr the memory buffer to read
+     * @param mask selection of the slots to read
+     * @return a new batch instance
+     */
+    template <class T, class A>
+    XSIMD_INLINE batch<T, A> load_masked(T const* ptr, batch_bool<T, A> const& mask) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        return kernel::load_masked<A>(ptr, mask, A {});
+    }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Creates a batch whose slots selected by \c mask take the consecutive
+     * elements of the buffer \c ptr, in order, the other slots being set to
+     * zero. This is the inverse of \ref compress_store: only as many
+     * elements as there are selected slots are read. The memory does not
+     * need to be aligned.
+     * @param ptr the memory buffer to read
+     * @param mask selection of the slots to fill
+     * @return a new batch instance
+     */
+    template <class T, class A>
+    XSIMD_INLINE batch<T, A> expand_load(T const* ptr, batch_bool<T, A> const& mask) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        return kernel::expand_load<A>(ptr, mask, batch<T, A>(T(0)), A {});
+    }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Creates a batch whose slots selected by \c mask take the consecutive
+     * elements of the buffer \c ptr, in order, the other slots being taken
+     * from \c src. Only as many elements as there are selected slots are
+     * read. The memory does not need to be aligned.
+     * @param ptr the memory buffer to read
+     * @param mask selection of the slots to fill
+     * @param src the values of the slots that are not selected
+     * @return a new batch instance
+     */
+    template <class T, class A>
+    XSIMD_INLINE batch<T, A> expand_load(T const* ptr, batch_bool<T, A> const& mask, batch<T, A> const& src) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        return kernel::expand_load<A>(ptr, mask, src, A {});
+    }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Loads \c N batches of \c N interleaved channels from the buffer
+     * \c ptr: element \c j of channel \c c is read at <tt>ptr[j * N + c]</tt>.
+     * Typical uses are RGB or RGBA pixels, multichannel audio samples and
+     * xyz coordinates. The memory does not need to be aligned.
+     * @tparam N number of channels
+     * @param ptr the memory buffer to read, holding <tt>N * batch<T, A>::size</tt> elements
+     * @return an array of \c N batches, one per channel
+     */
+    template <std::size_t N, class A = default_arch, class T>
+    XSIMD_INLINE std::array<batch<T, A>, N> load_interleaved(T const* ptr) noexcept
+    {
+        static_assert(N > 0, "at least one channel is needed");
+        detail::static_check_supported_config<T, A>();
+        std::array<batch<T, A>, N> res;
+        kernel::load_interleaved<A>(ptr, res, A {});
+        return res;
+    }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Creates a batch from the \c n first elements of the buffer \c ptr,
+     * typically the tail of a loop. Remaining slots are set to zero and the
+     * memory past \c ptr + \c n is never accessed. The memory does not
+     * need to be aligned.
+     * @param ptr the memory buffer to read
+     * @param n number of elements to read, at most the batch size
+     * @return a new batch instance
+     */
+    template <class A = default_arch, class T>
+    XSIMD_INLINE batch<T, A> load_partial(T const* ptr, std::size_t n) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        assert((n <= batch<T, A>::size) && "partial load cannot read more than a batch");
+        return kernel::load_partial<A>(ptr, n, A {});
+    }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Creates a batch from the elements of the buffer \c ptr separated by a
+     * compile-time \c Stride: slot \c i is read at <tt>ptr[i * Stride]</tt>,
+     * typically a column of a row-major matrix. Only the elements up to the
+     * last one read are accessed. The memory does not need to be aligned.
+     * @tparam Stride distance between two consecutive elements, in elements
+     * @param ptr the memory buffer to read
+     * @return a new batch instance
+     */
+    template <std::size_t Stride, class A = default_arch, class T>
+    XSIMD_INLINE batch<T, A> load_strided(T const* ptr) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        return kernel::load_strided<A, Stride>(ptr, A {});
+    }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Creates a batch from the elements of the buffer \c ptr separated by
+     * \c stride: slot \c i is read at <tt>ptr[i * stride]</tt>. The stride
+     * may be zero or negative. Only the elements read are accessed. The
+     * memory does not need to be aligned.
+     * @param ptr the memory buffer to read
+     * @param stride distance between two consecutive elements, in elements
+     * @return a new batch instance
+     */
+    template <class A = default_arch, class T>
+    XSIMD_INLINE batch<T, A> load_strided(T const* ptr, std::ptrdiff_t stride) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        return kernel::load_strided<A>(ptr, stride, A {});
+    }
+
     /**
      * @ingroup batch_data_transfer
      *
@@ -1453,6 +1710,26 @@ namespace xsimd
         return kernel::log1p<A>(x, A {});
     }
 
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Two-table lookup: slot \c i of the result is slot \c idx[i] of the
+     * vector formed by the concatenation of \c table_lo and \c table_hi.
+     * Only the low bits of each index, enough to address both tables, are
+     * taken into account.
+     * @param table_lo batch holding the first half of the table.
+     * @param table_hi batch holding the second half of the table.
+     * @param idx batch of indices.
+     * @return the looked up values.
+     */
+    template <class T, class A>
+    XSIMD_INLINE batch<T, A> lookup(batch<T, A> const& table_lo, batch<T, A> const& table_hi, batch<as_unsigned_integer_t<T>, A> const& idx) noexcept
+    {
+        static_assert(std::is_integral<T>::value, "lookup only supports integral tables");
+        detail::static_check_supported_config<T, A>();
+        return kernel::lookup<A>(table_lo, table_hi, idx, A {});
+    }
+
     /**
      * @ingroup batch_logical
      *
@@ -1468,6 +1745,40 @@ namespace xsimd
         return x < y;
     }
 
+    /**
+     * @ingroup batch_arithmetic
+     *
+     * Multiplies the low 52 bits of \c x and \c y, and adds the high 52 bits
+     * of the 104 bit product to \c z.
+     * @param z batch of accumulators.
+     * @param x batch of unsigned integers, only the low 52 bits are used.
+     * @param y batch of unsigned integers, only the low 52 bits are used.
+     * @return the updated accumulators.
+     */
+    template <class A>
+    XSIMD_INLINE batch<uint64_t, A> madd52hi(batch<uint64_t, A> const& z, batch<uint64_t, A> const& x, batch<uint64_t, A> const& y) noexcept
+    {
+        detail::static_check_supported_config<uint64_t, A>();
+        return kernel::madd52hi<A>(z, x, y, A {});
+    }
+
+    /**
+     * @ingroup batch_arithmetic
+     *
+     * Multiplies the low 52 bits of \c x and \c y, and adds the low 52 bits
+     * of the 104 bit product to \c z.
+     * @param z batch of accumulators.
+     * @param x batch of unsigned integers, only the low 52 bits are used.
+     * @param y batch of unsigned integers, only the low 52 bits are used.
+     * @return the updated accumulators.
+     */
+    template <class A>
+    XSIMD_INLINE batch<uint64_t, A> madd52lo(batch<uint64_t, A> const& z, batch<uint64_t, A> const& x, batch<uint64_t, A> const& y) noexcept
+    {
+        detail::static_check_supported_config<uint64_t, A>();
+        return kernel::madd52lo<A>(z, x, y, A {});
+    }
+
     /**
      * @ingroup batch_math
      *
@@ -1483,6 +1794,23 @@ namespace xsimd
         return kernel::max<A>(x, y, A {});
     }
 
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Merges the batches \c x and \c y, each sorted in ascending order, with
+     * a bitonic merging network. On return, \c x holds the smallest half of
+     * their elements and \c y the greatest half, both sorted in ascending
+     * order. The result is unspecified if the batches contain NaN.
+     * @param x first sorted batch, replaced by the lower half
+     * @param y second sorted batch, replaced by the upper half
+     */
+    template <class T, class A>
+    XSIMD_INLINE void merge(batch<T, A>& x, batch<T, A>& y) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        kernel::merge<A>(x, y, A {});
+    }
+
     /**
      * @ingroup batch_math
      *
@@ -1513,6 +1841,40 @@ namespace xsimd
         return B(-std::numeric_limits<T>::infinity());
     }
 
+    /**
+     * @ingroup batch_arithmetic
+     *
+     * Integer matrix multiply-accumulate. Each 128-bit block of \c x holds a
+     * row-major 2x8 matrix, the matching block of \c y holds the transpose of
+     * a 8x2 matrix, and their 2x2 product is added to the matching row-major
+     * 2x2 block of \c acc.
+     * @param acc batch of 32-bit accumulators.
+     * @param x batch of 8-bit integers, the left operand.
+     * @param y batch of 8-bit integers, the transposed right operand.
+     * @return the updated accumulators.
+     */
+    template <class A>
+    XSIMD_INLINE batch<int32_t, A> mmla(batch<int32_t, A> const& acc, batch<int8_t, A> const& x, batch<int8_t, A> const& y) noexcept
+    {
+        detail::static_check_supported_config<int32_t, A>();
+        detail::static_check_supported_config<int8_t, A>();
+        return kernel::mmla<A>(acc, x, y, A {});
+    }
+    template <class A>
+    XSIMD_INLINE batch<uint32_t, A> mmla(batch<uint32_t, A> const& acc, batch<uint8_t, A> const& x, batch<uint8_t, A> const& y) noexcept
+    {
+        detail::static_check_supported_config<uint32_t, A>();
+        detail::static_check_supported_config<uint8_t, A>();
+        return kernel::mmla<A>(acc, x, y, A {});
+    }
+    template <class A>
+    XSIMD_INLINE batch<int32_t, A> mmla(batch<int32_t, A> const& acc, batch<uint8_t, A> const& x, batch<int8_t, A> const& y) noexcept
+    {
+        detail::static_check_supported_config<int32_t, A>();
+        detail::static_check_supported_config<uint8_t, A>();
+        return kernel::mmla<A>(acc, x, y, A {});
+    }
+
     /**
      * @ingroup batch_arithmetic
      *
@@ -1544,6 +1906,21 @@ namespace xsimd
         return x * y;
     }
 
+    /**
+     * @ingroup batch_arithmetic
+     *
+     * Computes the high 64 bits of the 128 bit product of \c x and \c y.
+     * @param x batch of unsigned integers.
+     * @param y batch of unsigned integers.
+     * @return the high half of the full product.
+     */
+    template <class A>
+    XSIMD_INLINE batch<uint64_t, A> mul_hi(batch<uint64_t, A> const& x, batch<uint64_t, A> const& y) noexcept
+    {
+        detail::static_check_supported_config<uint64_t, A>();
+        return kernel::mul_hi<A>(x, y, A {});
+    }
+
     /**
      * @ingroup batch_rounding
      *
@@ -1744,6 +2121,22 @@ namespace xsimd
         return kernel::ipow<A>(x, y, A {});
     }
 
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Hints the processor to bring the cache line holding \c ptr closer,
+     * without faulting if the address is invalid.
+     * @tparam Locality temporal locality of the data, from 0 (used once,
+     * avoid polluting the caches) to 3 (keep in all cache levels).
+     * @param ptr address to prefetch
+     */
+    template <int Locality = 3, class A = default_arch, class T>
+    XSIMD_INLINE void prefetch(T const* ptr) noexcept
+    {
+        static_assert(Locality >= 0 && Locality <= 3, "locality ranges from 0 to 3");
+        kernel::prefetch<A, Locality>(ptr, A {});
+    }
+
     /**
      * @ingroup batch_complex
      *
@@ -1817,6 +2210,36 @@ namespace xsimd
         return kernel::reduce_add<A>(x, A {});
     }
 
+    /**
+     * @ingroup batch_reducers
+     *
+     * Index of the greatest scalar of the batch \c x, the first one in case
+     * of ties. The result is unspecified if \c x contains NaN.
+     * @param x batch involved in the reduction
+     * @return the lane index of the maximum.
+     */
+    template <class T, class A>
+    XSIMD_INLINE std::size_t reduce_argmax(batch<T, A> const& x) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        return kernel::reduce_argmax<A>(x, A {});
+    }
+
+    /**
+     * @ingroup batch_reducers
+     *
+     * Index of the smallest scalar of the batch \c x, the first one in case
+     * of ties. The result is unspecified if \c x contains NaN.
+     * @param x batch involved in the reduction
+     * @return the lane index of the minimum.
+     */
+    template <class T, class A>
+    XSIMD_INLINE std::size_t reduce_argmin(batch<T, A> const& x) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        return kernel::reduce_argmin<A>(x, A {});
+    }
+
     /**
      * @ingroup batch_reducers
      *
@@ -1845,6 +2268,21 @@ namespace xsimd
         return kernel::reduce_min<A>(x, A {});
     }
 
+    /**
+     * @ingroup batch_reducers
+     *
+     * Computes the inclusive prefix sum of the batch \c x: slot \c i of the
+     * result holds the sum of the slots \c 0 to \c i of \c x.
+     * @param x batch involved in the scan
+     * @return the prefix sum of \c x.
+     */
+    template <class T, class A>
+    XSIMD_INLINE batch<T, A> prefix_sum(batch<T, A> const& x) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        return kernel::prefix_sum<A>(x, A {});
+    }
+
     /**
      * @ingroup batch_math
      *
@@ -2006,6 +2444,24 @@ namespace xsimd
         return kernel::sadd<A>(x, y, A {});
     }
 
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Adds each slot of \c values to <tt>dst[index[i]]</tt>. Unlike
+     * batch::scatter, slots sharing the same index all contribute to the
+     * stored sum. For floating point values, the order in which colliding
+     * slots are summed is unspecified.
+     * @param dst pointer to the destination array.
+     * @param index batch of indices into \c dst.
+     * @param values batch of values to accumulate.
+     */
+    template <class T, class A, class V>
+    XSIMD_INLINE void scatter_add(T* dst, batch<V, A> const& index, batch<T, A> const& values) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        kernel::scatter_add<A>(dst, index, values, A {});
+    }
+
     /**
      * @ingroup batch_miscellaneous
      *
@@ -2201,6 +2657,22 @@ namespace xsimd
         return kernel::slide_right<N, A>(x, A {});
     }
 
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Sorts the slots of the batch \c x in ascending order with a bitonic
+     * sorting network built on \ref swizzle, \ref min and \ref max. The
+     * result is unspecified if \c x contains NaN.
+     * @param x batch to sort
+     * @return the sorted batch.
+     */
+    template <class T, class A>
+    XSIMD_INLINE batch<T, A> sort(batch<T, A> const& x) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        return kernel::sort<A>(x, A {});
+    }
+
     /**
      * @ingroup batch_math
      *
@@ -2348,6 +2820,115 @@ namespace xsimd
         store_as<T, A>(mem, val, aligned_mode {});
     }
 
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Copy the slots of batch \c val selected by \c mask to the buffer
+     * \c mem. The memory of the other slots is neither read nor written.
+     * The memory does not need to be aligned.
+     * @param mem the memory buffer to write to
+     * @param val the batch to copy from
+     * @param mask selection of the slots to write
+     */
+    template <class T, class A>
+    XSIMD_INLINE void store_masked(T* mem, batch<T, A> const& val, batch_bool<T, A> const& mask) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        kernel::store_masked<A>(mem, val, mask, A {});
+    }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Stores the \c N channels \c vals interleaved to the buffer \c mem:
+     * element \c j of channel \c c is written at <tt>mem[j * N + c]</tt>.
+     * This is the inverse of \ref load_interleaved. The memory does not need
+     * to be aligned.
+     * @tparam N number of channels
+     * @param mem the memory buffer to write to, holding <tt>N * batch<T, A>::size</tt> elements
+     * @param vals the channels to interleave
+     */
+    template <std::size_t N, class T, class A>
+    XSIMD_INLINE void store_interleaved(T* mem, std::array<batch<T, A>, N> const& vals) noexcept
+    {
+        static_assert(N > 0, "at least one channel is needed");
+        detail::static_check_supported_config<T, A>();
+        kernel::store_interleaved<A>(mem, vals, A {});
+    }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Copy the \c n first slots of batch \c val to the buffer \c mem,
+     * typically the tail of a loop. The memory past \c mem + \c n is
+     * never accessed. The memory does not need to be aligned.
+     * @param mem the memory buffer to write to
+     * @param val the batch to copy from
+     * @param n number of elements to write, at most the batch size
+     */
+    template <class A, class T>
+    XSIMD_INLINE void store_partial(T* mem, batch<T, A> const& val, std::size_t n) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        assert((n <= batch<T, A>::size) && "partial store cannot write more than a batch");
+        kernel::store_partial<A>(mem, val, n, A {});
+    }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Copy the slots of batch \c val to the buffer \c mem, separated by a
+     * compile-time \c Stride: slot \c i is written at
+     * <tt>mem[i * Stride]</tt>. The elements in between are neither read nor
+     * written. The memory does not need to be aligned.
+     * @tparam Stride distance between two consecutive elements, in elements
+     * @param mem the memory buffer to write to
+     * @param val the batch to copy from
+     */
+    template <std::size_t Stride, class T, class A>
+    XSIMD_INLINE void store_strided(T* mem, batch<T, A> const& val) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        kernel::store_strided<A, Stride>(mem, val, A {});
+    }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Copy the slots of batch \c val to the buffer \c mem, separated by
+     * \c stride: slot \c i is written at <tt>mem[i * stride]</tt>. The
+     * elements in between are neither read nor written. The memory does not
+     * need to be aligned.
+     * @param mem the memory buffer to write to
+     * @param val the batch to copy from
+     * @param stride distance between two consecutive elements, in elements
+     */
+    template <class T, class A>
+    XSIMD_INLINE void store_strided(T* mem, batch<T, A> const& val, std::ptrdiff_t stride) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        kernel::store_strided<A>(mem, val, stride, A {});
+    }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Copy content of batch \c val to the buffer \c mem with a
+     * non-temporal hint, so that large outputs do not evict the working set
+     * from the caches. The memory needs to be aligned. Streaming stores are
+     * weakly ordered, see \ref stream_fence.
+     * @param mem the memory buffer to write to
+     * @param val the batch to copy
+     */
+    template <class A, class T>
+    XSIMD_INLINE void store_stream(T* mem, batch<T, A> const& val) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        assert(((reinterpret_cast<uintptr_t>(mem) % A::alignment()) == 0)
+               && "store location is not properly aligned");
+        kernel::store_stream<A>(mem, val, A {});
+    }
+
     /**
      * @ingroup batch_data_transfer
      *
@@ -2362,6 +2943,18 @@ namespace xsimd
         store_as<T, A>(mem, val, unaligned_mode {});
     }
 
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Orders the streaming stores issued by \ref store_stream before any
+     * later store, typically before publishing the buffer to another thread.
+     */
+    template <class A = default_arch>
+    XSIMD_INLINE void stream_fence() noexcept
+    {
+        kernel::stream_fence<A>(A {});
+    }
+
     /**
      * @ingroup batch_arithmetic
      *
@@ -2486,6 +3079,72 @@ namespace xsimd
         return batch_cast<as_float_t<T>>(i);
     }
 
+    /**
+     * @ingroup batch_conversion
+     *
+     * Widens the half precision batch \c x to single precision. As a \c float
+     * takes twice the room of a \ref float16, the result is split in two
+     * batches holding respectively the lower and the upper half of \c x.
+     * @param x batch of \ref float16.
+     * @return the lower and upper halves of \c x converted to \c float.
+     */
+    template <class A>
+    XSIMD_INLINE std::array<batch<float, A>, 2> to_float(batch<float16, A> const& x) noexcept
+    {
+        detail::static_check_supported_config<float16, A>();
+        return kernel::to_float<A>(x, A {});
+    }
+
+    /**
+     * @ingroup batch_conversion
+     *
+     * Widens the brain floating point batch \c x to single precision. The
+     * conversion is exact, the result holds respectively the lower and the
+     * upper half of \c x.
+     * @param x batch of \ref bfloat16.
+     * @return the lower and upper halves of \c x converted to \c float.
+     */
+    template <class A>
+    XSIMD_INLINE std::array<batch<float, A>, 2> to_float(batch<bfloat16, A> const& x) noexcept
+    {
+        detail::static_check_supported_config<bfloat16, A>();
+        return kernel::to_float<A>(x, A {});
+    }
+
+    /**
+     * @ingroup batch_conversion
+     *
+     * Narrows \c lo and \c hi to brain floating point, rounding to nearest
+     * even, and packs them in a single batch. This is the inverse of
+     * \ref to_float on a \c batch<bfloat16>.
+     * @param lo batch of \c float stored in the lower half of the result.
+     * @param hi batch of \c float stored in the upper half of the result.
+     * @return \c lo and \c hi converted to \ref bfloat16.
+     */
+    template <class A>
+    XSIMD_INLINE batch<bfloat16, A> to_bfloat16(batch<float, A> const& lo, batch<float, A> const& hi) noexcept
+    {
+        detail::static_check_supported_config<bfloat16, A>();
+        return kernel::to_bfloat16<A>(lo, hi, A {});
+    }
+
+    /**
+     * @ingroup batch_conversion
+     *
+     * Narrows \c lo and \c hi to half precision, rounding to nearest even,
+     * and packs them in a single batch. This is the inverse of \ref to_float
+     * on a \c batch<float16>.
+     * @param lo batch of \c float stored in the lower half of the result.
+     * @param hi batch of \c float stored in the upper half of the result.
+     * @return \c lo and \c hi converted to \ref float16.
+     */
+    template <class A>
+    XSIMD_INLINE batch<float16, A> to_float16(batch<float, A> const& lo, batch<float, A> const& hi) noexcept
+    {
+        detail::static_check_supported_config<float16, A>();
+        return kernel::to_float16<A>(lo, hi, A {});
+    }
+
     /**
      * @ingroup batch_conversion
      *
@@ -12,6 +12,8 @@
 #ifndef XSIMD_AVX512F_REGISTER_HPP
 #define XSIMD_AVX512F_REGISTER_HPP
 
+#include "./xsimd_bfloat16.hpp"
+#include "./xsimd_float16.hpp"
 #include "./xsimd_generic_arch.hpp"
 
 namespace xsimd
@@ -64,6 +66,8 @@ namespace xsimd
         XSIMD_DECLARE_SIMD_REGISTER(unsigned long long int, avx512f, __m512i);
         XSIMD_DECLARE_SIMD_REGISTER(long long int, avx512f, __m512i);
         XSIMD_DECLARE_SIMD_REGISTER(float, avx512f, __m512);
+        XSIMD_DECLARE_SIMD_REGISTER(bfloat16, avx512f, __m512i);
+        XSIMD_DECLARE_SIMD_REGISTER(float16, avx512f, __m512i);
         XSIMD_DECLARE_SIMD_REGISTER(double, avx512f, __m512d);
 
     }
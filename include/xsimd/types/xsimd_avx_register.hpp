@@ -12,6 +12,8 @@
 #ifndef XSIMD_AVX_REGISTER_HPP
 #define XSIMD_AVX_REGISTER_HPP
 
+#include "./xsimd_bfloat16.hpp"
+#include "./xsimd_float16.hpp"
 #include "./xsimd_generic_arch.hpp"
 
 namespace xsimd
@@ -53,6 +55,8 @@ namespace xsimd
         XSIMD_DECLARE_SIMD_REGISTER(unsigned long long int, avx, __m256i);
         XSIMD_DECLARE_SIMD_REGISTER(long long int, avx, __m256i);
         XSIMD_DECLARE_SIMD_REGISTER(float, avx, __m256);
+        XSIMD_DECLARE_SIMD_REGISTER(bfloat16, avx, __m256i);
+        XSIMD_DECLARE_SIMD_REGISTER(float16, avx, __m256i);
         XSIMD_DECLARE_SIMD_REGISTER(double, avx, __m256d);
     }
 }
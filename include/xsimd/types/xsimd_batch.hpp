@@ -155,6 +155,8 @@ namespace xsimd
         template <class U, class V>
         XSIMD_NO_DISCARD static XSIMD_INLINE batch gather(U const* src, batch<V, arch_type> const& index) noexcept;
         template <class U, class V>
+        XSIMD_NO_DISCARD static XSIMD_INLINE batch gather(U const* src, batch<V, arch_type> const& index, batch_bool_type const& mask, batch const& fallback) noexcept;
+        template <class U, class V>
         XSIMD_INLINE void scatter(U* dst, batch<V, arch_type> const& index) const noexcept;
 
         XSIMD_INLINE T get(std::size_t i) const noexcept;
@@ -667,6 +669,24 @@ namespace xsimd
         return kernel::gather(batch {}, src, index, A {});
     }
 
+    /**
+     * Create a new batch gathering the elements selected by \c mask starting
+     * at address \c src and offset by the matching element in \c index, the
+     * other elements being taken from \c fallback. The memory addressed by
+     * the indices of the slots that are not selected is never accessed,
+     * so they may be out of bounds.
+     * If \c T is not of the same size as \c U, a \c static_cast is performed
+     * at element gather time.
+     */
+    template <class T, class A>
+    template <typename U, typename V>
+    XSIMD_INLINE batch<T, A> batch<T, A>::gather(U const* src, batch<V, A> const& index, batch_bool_type const& mask, batch const& fallback) noexcept
+    {
+        detail::static_check_supported_config<T, A>();
+        static_assert(std::is_convertible<T, U>::value, "Can't convert from src to this batch's type!");
+        return kernel::gather(fallback, src, index, mask, A {});
+    }
+
     /**
      * Scatter elements from this batch into addresses starting at \c dst
      * and offset by each element in \c index.
@@ -0,0 +1,86 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#ifndef XSIMD_BFLOAT16_HPP
+#define XSIMD_BFLOAT16_HPP
+
+#include <cstdint>
+
+#include "../config/xsimd_inline.hpp"
+#include "./xsimd_utils.hpp"
+
+namespace xsimd
+{
+    namespace detail
+    {
+        // bfloat16 is the upper half of a binary32, widening is exact and
+        // narrowing rounds to nearest even. Nan keeps its sign and upper
+        // payload and is quieted so it cannot round to infinity.
+        XSIMD_INLINE float bfloat16_bits_to_float(uint16_t h) noexcept
+        {
+            return bit_cast<float>(uint32_t(h) << 16);
+        }
+
+        XSIMD_INLINE uint16_t float_to_bfloat16_bits(float f) noexcept
+        {
+            uint32_t bits = bit_cast<uint32_t>(f);
+            if ((bits & 0x7FFFFFFFu) > 0x7F800000u)
+                return static_cast<uint16_t>((bits | 0x400000u) >> 16);
+            bits += 0x7FFFu + ((bits >> 16) & 1u);
+            return static_cast<uint16_t>(bits >> 16);
+        }
+    }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * Brain floating point storage type, the upper 16 bits of an IEEE 754
+     * single precision value. Like \ref float16 it only converts from and
+     * to \c float, batches are obtained through \ref load_as and written
+     * back through \ref store_as. \c batch<bfloat16> is a storage batch,
+     * converted from and to \c batch<float> by \ref to_bfloat16 and
+     * \ref to_float.
+     */
+    class bfloat16
+    {
+    public:
+        bfloat16() noexcept = default;
+
+        XSIMD_INLINE bfloat16(float value) noexcept
+            : m_bits(detail::float_to_bfloat16_bits(value))
+        {
+        }
+
+        XSIMD_INLINE operator float() const noexcept
+        {
+            return detail::bfloat16_bits_to_float(m_bits);
+        }
+
+        static XSIMD_INLINE bfloat16 from_bits(uint16_t bits) noexcept
+        {
+            bfloat16 res;
+            res.m_bits = bits;
+            return res;
+        }
+
+        XSIMD_INLINE uint16_t bits() const noexcept
+        {
+            return m_bits;
+        }
+
+    private:
+        uint16_t m_bits;
+    };
+
+    static_assert(sizeof(bfloat16) == sizeof(uint16_t), "bfloat16 has the layout of the upper half of a binary32");
+}
+
+#endif
@@ -0,0 +1,119 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#ifndef XSIMD_FLOAT16_HPP
+#define XSIMD_FLOAT16_HPP
+
+#include <cstdint>
+
+#include "../config/xsimd_inline.hpp"
+#include "./xsimd_utils.hpp"
+
+namespace xsimd
+{
+    namespace detail
+    {
+        // Scalar IEEE 754 binary16 <-> binary32 conversions, the float to
+        // half direction rounds to nearest even. Both follow the branch
+        // structure of the generic batch implementation.
+        XSIMD_INLINE float float16_bits_to_float(uint16_t h) noexcept
+        {
+            const uint32_t shifted_exp = 0x7C00u << 13;
+            uint32_t o = (uint32_t(h) & 0x7FFFu) << 13;
+            uint32_t exp = o & shifted_exp;
+            o += (127u - 15u) << 23;
+            if (exp == shifted_exp)
+            {
+                // infinity or nan, nan is quieted like the hardware converters do
+                o += (128u - 16u) << 23;
+                if (o & 0x7FFFFFu)
+                    o |= 0x400000u;
+            }
+            else if (exp == 0)
+            {
+                // zero or subnormal, renormalized by the float unit
+                o += 1u << 23;
+                o = bit_cast<uint32_t>(bit_cast<float>(o) - bit_cast<float>(113u << 23));
+            }
+            return bit_cast<float>(o | ((uint32_t(h) & 0x8000u) << 16));
+        }
+
+        XSIMD_INLINE uint16_t float_to_float16_bits(float f) noexcept
+        {
+            uint32_t bits = bit_cast<uint32_t>(f);
+            uint32_t sign = bits & 0x80000000u;
+            bits ^= sign;
+            uint32_t o;
+            if (bits >= ((127u + 16u) << 23))
+            {
+                // overflow to infinity, nan stays a quiet nan
+                o = bits > (255u << 23) ? 0x7E00u : 0x7C00u;
+            }
+            else if (bits < (113u << 23))
+            {
+                // subnormal or zero result, the float adder does the rounding
+                const uint32_t denorm_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+                o = bit_cast<uint32_t>(bit_cast<float>(bits) + bit_cast<float>(denorm_magic)) - denorm_magic;
+            }
+            else
+            {
+                uint32_t mant_odd = (bits >> 13) & 1u;
+                bits += (15u << 23) - (127u << 23) + 0xFFFu;
+                bits += mant_odd;
+                o = bits >> 13;
+            }
+            return static_cast<uint16_t>(o | (sign >> 16));
+        }
+    }
+
+    /**
+     * @ingroup batch_data_transfer
+     *
+     * IEEE 754 half precision floating point storage type. It only provides
+     * conversions from and to \c float, computations are meant to happen on
+     * \c batch<float> obtained through \ref load_as and written back through
+     * \ref store_as.
+     */
+    class float16
+    {
+    public:
+        float16() noexcept = default;
+
+        XSIMD_INLINE float16(float value) noexcept
+            : m_bits(detail::float_to_float16_bits(value))
+        {
+        }
+
+        XSIMD_INLINE operator float() const noexcept
+        {
+            return detail::float16_bits_to_float(m_bits);
+        }
+
+        static XSIMD_INLINE float16 from_bits(uint16_t bits) noexcept
+        {
+            float16 res;
+            res.m_bits = bits;
+            return res;
+        }
+
+        XSIMD_INLINE uint16_t bits() const noexcept
+        {
+            return m_bits;
+        }
+
+    private:
+        uint16_t m_bits;
+    };
+
+    static_assert(sizeof(float16) == sizeof(uint16_t), "float16 has the layout of a binary16");
+}
+
+#endif
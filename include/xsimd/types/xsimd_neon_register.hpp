@@ -12,6 +12,8 @@
 #ifndef XSIMD_NEON_REGISTER_HPP
 #define XSIMD_NEON_REGISTER_HPP
 
+#include "xsimd_bfloat16.hpp"
+#include "xsimd_float16.hpp"
 #include "xsimd_generic_arch.hpp"
 #include "xsimd_register.hpp"
 
@@ -99,6 +101,8 @@ namespace xsimd
         XSIMD_DECLARE_SIMD_REGISTER(long long int, neon, detail::neon_vector_type<long long int>);
         XSIMD_DECLARE_SIMD_REGISTER(unsigned long long int, neon, detail::neon_vector_type<unsigned long long int>);
         XSIMD_DECLARE_SIMD_REGISTER(float, neon, float32x4_t);
+        XSIMD_DECLARE_SIMD_REGISTER(bfloat16, neon, detail::neon_vector_type<unsigned short>);
+        XSIMD_DECLARE_SIMD_REGISTER(float16, neon, detail::neon_vector_type<unsigned short>);
         XSIMD_DECLARE_INVALID_SIMD_REGISTER(double, neon);
 
         namespace detail
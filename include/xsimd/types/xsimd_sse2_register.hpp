@@ -12,6 +12,8 @@
 #ifndef XSIMD_SSE2_REGISTER_HPP
 #define XSIMD_SSE2_REGISTER_HPP
 
+#include "./xsimd_bfloat16.hpp"
+#include "./xsimd_float16.hpp"
 #include "./xsimd_generic_arch.hpp"
 #include "./xsimd_register.hpp"
 
@@ -51,6 +53,8 @@ namespace xsimd
         XSIMD_DECLARE_SIMD_REGISTER(unsigned long long int, sse2, __m128i);
         XSIMD_DECLARE_SIMD_REGISTER(long long int, sse2, __m128i);
         XSIMD_DECLARE_SIMD_REGISTER(float, sse2, __m128);
+        XSIMD_DECLARE_SIMD_REGISTER(bfloat16, sse2, __m128i);
+        XSIMD_DECLARE_SIMD_REGISTER(float16, sse2, __m128i);
         XSIMD_DECLARE_SIMD_REGISTER(double, sse2, __m128d);
     }
 #endif
@@ -13,11 +13,14 @@
 #define XSIMD_UTILS_HPP
 
 #include <complex>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <tuple>
 #include <type_traits>
 
+#include "../config/xsimd_inline.hpp"
+
 #ifdef XSIMD_ENABLE_XTL_COMPLEX
 #include "xtl/xcomplex.hpp"
 #endif
@@ -237,6 +240,25 @@ namespace xsimd
         } // namespace detail
     } // namespace kernel
 
+    /************
+     * popcount *
+     ************/
+
+    namespace detail
+    {
+        XSIMD_INLINE std::size_t popcount(uint64_t bits) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<std::size_t>(__builtin_popcountll(bits));
+#else
+            std::size_t count = 0;
+            for (; bits != 0; bits &= bits - 1)
+                ++count;
+            return count;
+#endif
+        }
+    }
+
     /*****************************************
      * Backport of index_sequence from c++14 *
      *****************************************/
@@ -13,6 +13,8 @@
 #ifndef XSIMD_WASM_REGISTER_HPP
 #define XSIMD_WASM_REGISTER_HPP
 
+#include "xsimd_bfloat16.hpp"
+#include "xsimd_float16.hpp"
 #include "xsimd_generic_arch.hpp"
 #include "xsimd_register.hpp"
 
@@ -51,6 +53,8 @@ namespace xsimd
         XSIMD_DECLARE_SIMD_REGISTER(unsigned long long int, wasm, v128_t);
         XSIMD_DECLARE_SIMD_REGISTER(long long int, wasm, v128_t);
         XSIMD_DECLARE_SIMD_REGISTER(float, wasm, v128_t);
+        XSIMD_DECLARE_SIMD_REGISTER(bfloat16, wasm, v128_t);
+        XSIMD_DECLARE_SIMD_REGISTER(float16, wasm, v128_t);
         XSIMD_DECLARE_SIMD_REGISTER(double, wasm, v128_t);
     }
 #endif
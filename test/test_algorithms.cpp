@@ -0,0 +1,386 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#include "xsimd/xsimd.hpp"
+#ifndef XSIMD_NO_SUPPORTED_ARCHITECTURE
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "xsimd/stl/algorithms.hpp"
+
+#include "test_utils.hpp"
+
+template <class B>
+struct algorithms_test
+{
+    using batch_type = B;
+    using value_type = typename B::value_type;
+    using arch_type = typename B::arch_type;
+    static constexpr size_t size = B::size;
+    using vector_type = std::vector<value_type, xsimd::default_allocator<value_type, arch_type>>;
+
+    // covers the empty range, a single partial batch, and ranges long
+    // enough to go through the unrolled loop with every kind of tail
+    std::vector<size_t> sizes() const
+    {
+        return { 0, 1, size - 1, size, size + 1, 4 * size - 1, 4 * size, 9 * size + 3, 32 * size + 1 };
+    }
+
+    static vector_type make_input(size_t n, size_t seed)
+    {
+        vector_type v(n);
+        for (size_t i = 0; i < n; ++i)
+            v[i] = static_cast<value_type>((i * 7 + seed) % 11);
+        return v;
+    }
+
+    void test_unary_transform() const
+    {
+        auto f = [](batch_type const& x)
+        { return x * x + batch_type(value_type(1)); };
+        for (size_t n : sizes())
+        {
+            for (size_t in_offset = 0; in_offset < 3; ++in_offset)
+            {
+                for (size_t out_offset = 0; out_offset < 3; ++out_offset)
+                {
+                    vector_type in = make_input(n + in_offset, 3);
+                    vector_type out(n + out_offset + 1, value_type(42));
+                    auto end = xsimd::transform(in.begin() + in_offset, in.end(), out.begin() + out_offset, f);
+                    INFO("size: ", n, ", input offset: ", in_offset, ", output offset: ", out_offset);
+                    CHECK((end == out.begin() + out_offset + n));
+                    size_t mismatch = 0;
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        value_type x = in[in_offset + i];
+                        mismatch += out[out_offset + i] != static_cast<value_type>(x * x + value_type(1));
+                    }
+                    CHECK_EQ(mismatch, 0u);
+                    // elements around the output range are left untouched
+                    for (size_t i = 0; i < out_offset; ++i)
+                        CHECK_EQ(out[i], value_type(42));
+                    CHECK_EQ(out.back(), value_type(42));
+                }
+            }
+        }
+    }
+
+    void test_binary_transform() const
+    {
+        auto f = [](batch_type const& x, batch_type const& y)
+        { return x - y; };
+        for (size_t n : sizes())
+        {
+            for (size_t offset = 0; offset < 2; ++offset)
+            {
+                vector_type lhs = make_input(n + offset, 5);
+                vector_type rhs = make_input(n, 2);
+                vector_type out(n);
+                xsimd::transform(lhs.begin() + offset, lhs.end(), rhs.begin(), out.begin(), f);
+                size_t mismatch = 0;
+                for (size_t i = 0; i < n; ++i)
+                    mismatch += out[i] != static_cast<value_type>(lhs[offset + i] - rhs[i]);
+                INFO("size: ", n, ", offset: ", offset);
+                CHECK_EQ(mismatch, 0u);
+
+                // container overload, both aligned
+                vector_type out2(n);
+                xsimd::transform(rhs, rhs, out2, f);
+                CHECK((out2 == vector_type(n, value_type(0))));
+            }
+        }
+    }
+
+    void test_division_transform() const
+    {
+        // the lanes past a partial head or tail must not be divided by zero
+        auto f = [](batch_type const& x)
+        { return batch_type(value_type(100)) / x; };
+        auto g = [](batch_type const& x, batch_type const& y)
+        { return x / y; };
+        for (size_t n : sizes())
+        {
+            for (size_t offset = 0; offset < 3; ++offset)
+            {
+                vector_type in(n + offset, value_type(7));
+                vector_type out(n + offset), ones(n + offset);
+                xsimd::transform(in.begin() + offset, in.end(), out.begin() + offset, f);
+                xsimd::transform(in.begin() + offset, in.end(), in.begin() + offset, ones.begin() + offset, g);
+                size_t mismatch = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    mismatch += out[offset + i] != static_cast<value_type>(value_type(100) / value_type(7));
+                    mismatch += ones[offset + i] != value_type(1);
+                }
+                INFO("size: ", n, ", offset: ", offset);
+                CHECK_EQ(mismatch, 0u);
+            }
+        }
+    }
+
+    void test_container_transform() const
+    {
+        auto f = [](batch_type const& x)
+        { return x + x; };
+        for (size_t n : sizes())
+        {
+            vector_type in = make_input(n, 1);
+            vector_type out(n);
+            xsimd::transform<arch_type, 2>(in, out, f);
+            std::vector<value_type> unaligned_out(n);
+            xsimd::transform<arch_type, 1>(in, unaligned_out, f);
+            size_t mismatch = 0;
+            for (size_t i = 0; i < n; ++i)
+            {
+                mismatch += out[i] != static_cast<value_type>(in[i] + in[i]);
+                mismatch += unaligned_out[i] != out[i];
+            }
+            INFO("size: ", n);
+            CHECK_EQ(mismatch, 0u);
+        }
+    }
+
+    void test_reduce() const
+    {
+        for (size_t n : sizes())
+        {
+            for (size_t offset = 0; offset < 3; ++offset)
+            {
+                vector_type in = make_input(n + offset, 4);
+                value_type expected_sum = std::accumulate(in.begin() + offset, in.end(), value_type(1),
+                                                          [](value_type x, value_type y)
+                                                          { return static_cast<value_type>(x + y); });
+                value_type expected_max = value_type(0);
+                for (size_t i = offset; i < in.size(); ++i)
+                    expected_max = std::max(expected_max, in[i]);
+
+                INFO("size: ", n, ", offset: ", offset);
+                CHECK_EQ(xsimd::reduce(in.begin() + offset, in.end(), value_type(1)), expected_sum);
+                CHECK_EQ((xsimd::reduce<arch_type, 3>(in.begin() + offset, in.end(), value_type(0), max_op())), expected_max);
+                if (offset == 0)
+                {
+                    CHECK_EQ(xsimd::reduce(in, value_type(1)), expected_sum);
+                    CHECK_EQ(xsimd::reduce(in, value_type(0), max_op()), expected_max);
+                }
+            }
+        }
+    }
+
+    void test_scan() const
+    {
+        for (size_t n : sizes())
+        {
+            for (size_t offset = 0; offset < 3; ++offset)
+            {
+                vector_type in = make_input(n + offset, 6);
+                vector_type inclusive(n), exclusive(n);
+                value_type sum = value_type(2);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    exclusive[i] = sum;
+                    sum = static_cast<value_type>(sum + in[offset + i]);
+                    inclusive[i] = sum;
+                }
+
+                INFO("size: ", n, ", offset: ", offset);
+                vector_type out(n + 1, value_type(42));
+                auto end = xsimd::inclusive_scan(in.begin() + offset, in.end(), out.begin() + 1, value_type(2));
+                CHECK((end == out.end()));
+                CHECK_EQ(out[0], value_type(42));
+                CHECK(std::equal(inclusive.begin(), inclusive.end(), out.begin() + 1));
+
+                xsimd::exclusive_scan(in.begin() + offset, in.end(), out.begin(), value_type(2));
+                CHECK(std::equal(exclusive.begin(), exclusive.end(), out.begin()));
+
+                // in place
+                vector_type inout(in.begin() + offset, in.end());
+                xsimd::inclusive_scan(inout.begin(), inout.end(), inout.begin(), value_type(2));
+                CHECK((inout == inclusive));
+                inout.assign(in.begin() + offset, in.end());
+                xsimd::exclusive_scan(inout.begin(), inout.end(), inout.begin(), value_type(2));
+                CHECK((inout == exclusive));
+            }
+        }
+    }
+
+    void test_extrema() const
+    {
+        // large enough to need several chunks of batch numbers on 8 bit types
+        std::vector<size_t> ns = sizes();
+        ns.push_back(300 * size + 5);
+        for (size_t n : ns)
+        {
+            for (size_t offset = 0; offset < 3; ++offset)
+            {
+                // many ties, and a unique extremum late in the range
+                vector_type in = make_input(n + offset, 8);
+                for (auto& v : in)
+                    v = static_cast<value_type>(v + 1);
+                if (n > 2)
+                {
+                    in[offset + n - n / 3] = value_type(0);
+                    in[offset + n / 2] = value_type(12);
+                }
+                auto first = in.begin() + offset;
+                auto expected = std::minmax_element(first, in.end());
+                INFO("size: ", n, ", offset: ", offset);
+                CHECK_EQ(xsimd::min_element(first, in.end()) - first, std::min_element(first, in.end()) - first);
+                CHECK_EQ(xsimd::max_element(first, in.end()) - first, std::max_element(first, in.end()) - first);
+                auto res = xsimd::minmax_element(first, in.end());
+                CHECK_EQ(res.first - first, expected.first - first);
+                CHECK_EQ(res.second - first, expected.second - first);
+            }
+        }
+    }
+
+    void test_sort() const
+    {
+        std::vector<size_t> ns = sizes();
+        ns.push_back(1000 * size + 7);
+        for (size_t n : ns)
+        {
+            // pseudo random values, few distinct values, sorted and reversed
+            vector_type in(n);
+            uint32_t state = 12345;
+            for (size_t i = 0; i < n; ++i)
+            {
+                state = state * 1103515245u + 12345u;
+                in[i] = static_cast<value_type>((state >> 16) % 1000);
+            }
+            std::vector<vector_type> inputs = { in, make_input(n, 9), vector_type(n, value_type(3)) };
+            vector_type sorted(in);
+            std::sort(sorted.begin(), sorted.end());
+            inputs.push_back(sorted);
+            inputs.emplace_back(sorted.rbegin(), sorted.rend());
+
+            for (size_t k = 0; k < inputs.size(); ++k)
+            {
+                for (size_t offset = 0; offset < 2 && offset <= n; ++offset)
+                {
+                    vector_type data = inputs[k];
+                    vector_type expected(data);
+                    std::sort(expected.begin() + offset, expected.end());
+                    xsimd::sort(data.begin() + offset, data.end());
+                    INFO("size: ", n, ", input: ", k, ", offset: ", offset);
+                    CHECK((data == expected));
+                }
+            }
+        }
+    }
+
+    void test_copy_if() const
+    {
+        auto pred = [](batch_type const& x)
+        { return x > batch_type(value_type(4)); };
+        auto scalar_pred = [](value_type x)
+        { return x > value_type(4); };
+        for (size_t n : sizes())
+        {
+            for (size_t offset = 0; offset < 3; ++offset)
+            {
+                vector_type in = make_input(n + offset, 5);
+                vector_type out(n + 1, value_type(42)), expected(n + 1, value_type(42));
+                auto end = xsimd::copy_if(in.begin() + offset, in.end(), out.begin(), pred);
+                auto expected_end = std::copy_if(in.begin() + offset, in.end(), expected.begin(), scalar_pred);
+                INFO("size: ", n, ", offset: ", offset);
+                CHECK_EQ(end - out.begin(), expected_end - expected.begin());
+                CHECK((out == expected));
+
+                // in place
+                end = xsimd::copy_if(in.begin() + offset, in.end(), in.begin() + offset, pred);
+                CHECK_EQ(end - (in.begin() + offset), expected_end - expected.begin());
+                CHECK(std::equal(expected.begin(), expected_end, in.begin() + offset));
+            }
+        }
+    }
+
+    void test_partition() const
+    {
+        auto pred = [](batch_type const& x)
+        { return x < batch_type(value_type(6)); };
+        auto scalar_pred = [](value_type x)
+        { return x < value_type(6); };
+        std::vector<size_t> ns = sizes();
+        ns.push_back(2 * size + 1);
+        for (size_t n : ns)
+        {
+            for (size_t offset = 0; offset < 3; ++offset)
+            {
+                vector_type data = make_input(n + offset, 2);
+                vector_type expected(data);
+                auto first = data.begin() + offset;
+                auto split = xsimd::partition(first, data.end(), pred);
+                INFO("size: ", n, ", offset: ", offset);
+                CHECK_EQ(split - first, std::count_if(first, data.end(), scalar_pred));
+                CHECK(std::is_partitioned(first, data.end(), scalar_pred));
+                CHECK(std::equal(data.begin(), first, expected.begin()));
+                std::sort(first, data.end());
+                std::sort(expected.begin() + offset, expected.end());
+                CHECK((data == expected));
+            }
+        }
+    }
+
+    void test_division_predicate() const
+    {
+        // the predicate must not see the zeros past a partial batch
+        auto pred = [](batch_type const& x)
+        { return batch_type(value_type(100)) / x > batch_type(value_type(20)); };
+        auto scalar_pred = [](value_type x)
+        { return value_type(100) / x > value_type(20); };
+        for (size_t n : sizes())
+        {
+            for (size_t offset = 0; offset < 3; ++offset)
+            {
+                vector_type in = make_input(n + offset, 3);
+                for (auto& x : in)
+                    x += value_type(1);
+                vector_type out(n), expected(n);
+                auto end = xsimd::copy_if(in.begin() + offset, in.end(), out.begin(), pred);
+                auto expected_end = std::copy_if(in.begin() + offset, in.end(), expected.begin(), scalar_pred);
+                INFO("size: ", n, ", offset: ", offset);
+                CHECK_EQ(end - out.begin(), expected_end - expected.begin());
+                auto split = xsimd::partition(in.begin() + offset, in.end(), pred);
+                CHECK_EQ(split - (in.begin() + offset), expected_end - expected.begin());
+                CHECK(std::is_partitioned(in.begin() + offset, in.end(), scalar_pred));
+            }
+        }
+    }
+
+private:
+    struct max_op
+    {
+        template <class T>
+        T operator()(T const& x, T const& y) const
+        {
+            return xsimd::max(x, y);
+        }
+    };
+};
+
+TEST_CASE_TEMPLATE("[algorithms]", B, BATCH_TYPES)
+{
+    algorithms_test<B> Test;
+    SUBCASE("unary transform") { Test.test_unary_transform(); }
+    SUBCASE("binary transform") { Test.test_binary_transform(); }
+    SUBCASE("division transform") { Test.test_division_transform(); }
+    SUBCASE("container transform") { Test.test_container_transform(); }
+    SUBCASE("reduce") { Test.test_reduce(); }
+    SUBCASE("scan") { Test.test_scan(); }
+    SUBCASE("extrema") { Test.test_extrema(); }
+    SUBCASE("sort") { Test.test_sort(); }
+    SUBCASE("copy_if") { Test.test_copy_if(); }
+    SUBCASE("partition") { Test.test_partition(); }
+    SUBCASE("division predicate") { Test.test_division_predicate(); }
+}
+#endif
@@ -13,8 +13,11 @@
 #ifndef XSIMD_NO_SUPPORTED_ARCHITECTURE
 
 #include <numeric>
+#include <string>
 #include <type_traits>
 
+#include "xsimd/config/xsimd_cpu_info.hpp"
+
 #include "test_sum.hpp"
 #include "test_utils.hpp"
 
@@ -29,6 +32,17 @@ static_assert(xsimd::all_architectures::contains<xsimd::default_arch>(), "defaul
 static_assert((std::is_same<xsimd::default_arch, xsimd::neon64>::value || !xsimd::neon64::supported()), "on arm, without sve, the best we can do is neon64");
 #endif
 
+#if XSIMD_WITH_AVX512BF16
+static_assert(std::is_same<xsimd::default_arch, xsimd::avx512bf16>::value, "avx512bf16 is ranked above every other x86 architecture");
+#endif
+
+static_assert(std::is_same<xsimd::prefer_width<256, xsimd::arch_list<xsimd::avx512bw, xsimd::avx512f, xsimd::avx2, xsimd::sse2>>,
+                           xsimd::arch_list<xsimd::avx2, xsimd::sse2, xsimd::avx512bw, xsimd::avx512f>>::value,
+              "narrower architectures come first, in the same order");
+static_assert(std::is_same<xsimd::prefer_width<128, xsimd::arch_list<xsimd::avx2, xsimd::sse2>>,
+                           xsimd::arch_list<xsimd::sse2, xsimd::avx2>>::value,
+              "wider architectures are kept as a fallback");
+
 struct check_supported
 {
     template <class Arch>
@@ -38,6 +52,24 @@ struct check_supported
     }
 };
 
+struct arch_name
+{
+    template <class Arch>
+    char const* operator()(Arch) const
+    {
+        return Arch::name();
+    }
+};
+
+struct arch_alignment
+{
+    template <class Arch>
+    std::size_t operator()(Arch) const
+    {
+        return Arch::alignment();
+    }
+};
+
 struct check_available
 {
     template <class Arch>
@@ -123,6 +155,84 @@ TEST_CASE("[multi arch support]")
 #endif
     }
 
+    SUBCASE("xsimd::resolve_dispatch(...)")
+    {
+        float data[17] = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f, 11.f, 12.f, 13.f, 14.f, 15.f, 16.f, 17.f };
+        float ref = std::accumulate(std::begin(data), std::end(data), 0.f);
+
+        {
+            auto dispatched = xsimd::resolve_dispatch<float(float const*, unsigned)>(sum {});
+            CHECK_EQ(ref, dispatched(data, 17));
+            CHECK_EQ(ref - 1.f, dispatched(data + 1, 16));
+        }
+
+        {
+            auto dispatched = xsimd::resolve_dispatch<float(float const*, unsigned), xsimd::arch_list<xsimd::best_arch>>(sum {});
+            CHECK_EQ(ref, dispatched(data, 17));
+        }
+
+        // the pointer is resolved when first requested, before any call
+        {
+            auto first = xsimd::dispatch_pointer<sum, float(float const*, unsigned)>();
+            CHECK_EQ(ref, first(data, 17));
+            auto resolved = xsimd::dispatch_pointer<sum, float(float const*, unsigned)>();
+            CHECK_EQ(ref, resolved(data, 17));
+            CHECK(first == resolved);
+            CHECK(resolved == xsimd::dispatch_pointer<sum, float(float const*, unsigned)>());
+        }
+    }
+
+    SUBCASE("xsimd::force_architecture(...)")
+    {
+        CHECK_FALSE(xsimd::force_architecture("not-an-arch"));
+        CHECK_FALSE(xsimd::disable_architecture("not-an-arch"));
+
+        CHECK_UNARY(xsimd::disable_architecture(xsimd::best_arch::name()));
+        CHECK_FALSE(xsimd::available_architectures().has(xsimd::best_arch {}));
+        xsimd::reset_architectures();
+
+#if XSIMD_WITH_AVX2 && XSIMD_WITH_SSE2
+        if (xsimd::available_architectures().has(xsimd::avx2 {}))
+        {
+            CHECK_UNARY(xsimd::force_architecture("sse2"));
+            CHECK_FALSE(xsimd::available_architectures().has(xsimd::sse4_2 {}));
+            CHECK_EQ(std::string("sse2"), xsimd::dispatch<xsimd::arch_list<xsimd::avx2, xsimd::sse2>>(arch_name {})());
+            xsimd::reset_architectures();
+            CHECK_EQ(std::string("avx2"), xsimd::dispatch<xsimd::arch_list<xsimd::avx2, xsimd::sse2>>(arch_name {})());
+        }
+#endif
+    }
+
+    SUBCASE("xsimd::prefer_width<...>")
+    {
+        CHECK_LE(xsimd::dispatch<xsimd::prefer_width<256>>(arch_alignment {})(), 32u);
+    }
+
+    SUBCASE("xsimd::cpu_info()")
+    {
+        auto info = xsimd::cpu_info();
+        CHECK_LE(info.physical_cores, info.logical_cores);
+        if (info.logical_cores != 0)
+        {
+            CHECK_GE(info.physical_cores, 1u);
+        }
+        if (info.l1d_cache_size != 0)
+        {
+            CHECK_UNARY(info.cache_line_size != 0 && (info.cache_line_size & (info.cache_line_size - 1)) == 0);
+            CHECK_LE(info.cache_line_size, info.l1d_cache_size);
+        }
+        CHECK_EQ(info.l2_cache_size, xsimd::cpu_info().l2_cache_size);
+    }
+
+#if XSIMD_WITH_SSE2
+    SUBCASE("xsimd::available_architectures() with scalable vectors")
+    {
+        CHECK_FALSE(xsimd::available_architectures().has(xsimd::detail::sve<128> {}));
+        CHECK_FALSE(xsimd::available_architectures().has(xsimd::detail::rvv<256> {}));
+        CHECK_EQ(std::string("sse2"), xsimd::dispatch<xsimd::arch_list<xsimd::detail::sve<512>, xsimd::detail::sve<256>, xsimd::detail::sve<128>, xsimd::sse2>>(arch_name {})());
+    }
+#endif
+
     SUBCASE("xsimd::make_sized_batch_t")
     {
         using batch4f = xsimd::make_sized_batch_t<float, 4>;
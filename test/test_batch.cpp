@@ -800,6 +800,28 @@ struct batch_test
             INFO("reduce_min");
             CHECK_SCALAR_EQ(res, expected);
         }
+        // reduce_argmax
+        {
+            size_t expected = std::max_element(lhs.cbegin(), lhs.cend()) - lhs.cbegin();
+            size_t res = reduce_argmax(batch_lhs());
+            INFO("reduce_argmax");
+            CHECK_EQ(res, expected);
+        }
+        // reduce_argmin
+        {
+            size_t expected = std::min_element(lhs.cbegin(), lhs.cend()) - lhs.cbegin();
+            size_t res = reduce_argmin(batch_lhs());
+            INFO("reduce_argmin");
+            CHECK_EQ(res, expected);
+        }
+        // prefix_sum
+        {
+            array_type expected;
+            std::partial_sum(lhs.cbegin(), lhs.cend(), expected.begin());
+            batch_type res = prefix_sum(batch_lhs());
+            INFO("prefix_sum");
+            CHECK_BATCH_EQ(res, expected);
+        }
     }
 
     template <size_t N>
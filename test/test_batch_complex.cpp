@@ -114,6 +114,19 @@ struct batch_complex_test
             CHECK_EQ(ares_real, areal);
             CHECK_EQ(ares_imag, aimag);
         }
+        {
+            std::array<value_type, 2 * size> interleaved, res;
+            for (size_t i = 0; i < size; ++i)
+            {
+                interleaved[2 * i] = lhs[i];
+                interleaved[2 * i + 1] = rhs[i];
+            }
+            std::array<batch_type, 2> channels = xsimd::load_interleaved<2, arch_type>(interleaved.data());
+            CHECK_EQ(channels[0], lhs);
+            CHECK_EQ(channels[1], rhs);
+            xsimd::store_interleaved(res.data(), channels);
+            CHECK_EQ(res, interleaved);
+        }
     }
 #ifdef XSIMD_ENABLE_XTL_COMPLEX
     void test_load_store_xtl() const
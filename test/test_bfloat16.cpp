@@ -0,0 +1,204 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#include "xsimd/xsimd.hpp"
+#ifndef XSIMD_NO_SUPPORTED_ARCHITECTURE
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "test_utils.hpp"
+
+struct bfloat16_test
+{
+    using batch_type = xsimd::batch<float>;
+    using vector_type = std::vector<xsimd::bfloat16, xsimd::aligned_allocator<xsimd::bfloat16, batch_type::arch_type::alignment()>>;
+    static constexpr size_t size = batch_type::size;
+
+    static float from_bits(uint32_t bits)
+    {
+        float res;
+        std::memcpy(&res, &bits, sizeof(res));
+        return res;
+    }
+
+    // round to nearest even computed on the bit pattern
+    static uint16_t reference(float f)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &f, sizeof(bits));
+        uint32_t res = bits >> 16;
+        uint32_t rem = bits & 0xFFFFu;
+        if (rem > 0x8000u || (rem == 0x8000u && (res & 1u)))
+            ++res;
+        return static_cast<uint16_t>(res);
+    }
+
+    void test_scalar() const
+    {
+        CHECK_EQ(xsimd::bfloat16(1.f).bits(), 0x3F80);
+        CHECK_EQ(xsimd::bfloat16(-2.f).bits(), 0xC000);
+        CHECK_EQ(float(xsimd::bfloat16::from_bits(0x4049)), 3.140625f);
+        // ties round to even
+        CHECK_EQ(xsimd::bfloat16(from_bits(0x3F808000u)).bits(), 0x3F80);
+        CHECK_EQ(xsimd::bfloat16(from_bits(0x3F818000u)).bits(), 0x3F82);
+        CHECK_EQ(xsimd::bfloat16(from_bits(0x3F808001u)).bits(), 0x3F81);
+        // the largest finite values round to infinity
+        CHECK_EQ(xsimd::bfloat16(std::numeric_limits<float>::max()).bits(), 0x7F80);
+        // a nan whose payload lives in the low half stays a nan
+        CHECK(std::isnan(float(xsimd::bfloat16(from_bits(0x7F800001u)))));
+    }
+
+    void test_load_as() const
+    {
+        vector_type values(1u << 16);
+        for (uint32_t i = 0; i < values.size(); ++i)
+            values[i] = xsimd::bfloat16::from_bits(static_cast<uint16_t>(i));
+
+        std::array<float, size> res;
+        size_t mismatch = 0;
+        for (size_t i = 0; i < values.size(); i += size)
+        {
+            auto b = (i / size) % 2 ? xsimd::load_as<float>(values.data() + i, xsimd::aligned_mode())
+                                    : xsimd::load_as<float>(values.data() + i, xsimd::unaligned_mode());
+            b.store_unaligned(res.data());
+            for (size_t j = 0; j < size; ++j)
+            {
+                uint32_t bits;
+                std::memcpy(&bits, &res[j], sizeof(bits));
+                mismatch += bits != (uint32_t(values[i + j].bits()) << 16);
+            }
+        }
+        INFO("load_as<float>(bfloat16 const*)");
+        CHECK_EQ(mismatch, 0u);
+    }
+
+    void test_store_as() const
+    {
+        std::vector<float> floats;
+        uint32_t seed = 12345;
+        for (size_t i = 0; i < (1u << 16); ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            // force ties on a part of the inputs
+            floats.push_back(from_bits(i % 4 ? seed : (seed & 0xFFFF0000u) | 0x8000u));
+        }
+
+        vector_type out(floats.size());
+        size_t mismatch = 0;
+        for (size_t i = 0; i < floats.size(); i += size)
+        {
+            auto b = batch_type::load_unaligned(floats.data() + i);
+            if ((i / size) % 2)
+                xsimd::store_as(out.data() + i, b, xsimd::aligned_mode());
+            else
+                xsimd::store_as(out.data() + i, b, xsimd::unaligned_mode());
+            for (size_t j = 0; j < size; ++j)
+            {
+                float f = floats[i + j];
+                if (std::isnan(f))
+                    mismatch += !std::isnan(float(out[i + j]));
+                else
+                    mismatch += out[i + j].bits() != reference(f);
+            }
+        }
+        INFO("store_as(bfloat16*, batch<float>)");
+        CHECK_EQ(mismatch, 0u);
+    }
+
+    void test_batch() const
+    {
+        test_batch<batch_type::arch_type>(xsimd::has_simd_register<xsimd::bfloat16, batch_type::arch_type> {});
+    }
+
+    template <class A>
+    void test_batch(std::false_type) const
+    {
+    }
+
+    template <class A>
+    void test_batch(std::true_type) const
+    {
+        using bf16_batch = xsimd::batch<xsimd::bfloat16, A>;
+        constexpr size_t bf16_size = bf16_batch::size;
+        static_assert(bf16_size == 2 * size, "a bfloat16 batch holds two float batches");
+
+        vector_type values(1u << 16), out(1u << 16);
+        for (uint32_t i = 0; i < values.size(); ++i)
+            values[i] = xsimd::bfloat16::from_bits(static_cast<uint16_t>(i));
+
+        std::array<float, 2 * size> widened;
+        size_t load_store_mismatch = 0, to_float_mismatch = 0, to_bfloat16_mismatch = 0;
+        for (size_t i = 0; i < values.size(); i += bf16_size)
+        {
+            bf16_batch b = (i / bf16_size) % 2 ? bf16_batch::load_aligned(values.data() + i)
+                                               : bf16_batch::load_unaligned(values.data() + i);
+            if ((i / bf16_size) % 2)
+                b.store_unaligned(out.data() + i);
+            else
+                b.store_aligned(out.data() + i);
+            for (size_t j = 0; j < bf16_size; ++j)
+                load_store_mismatch += out[i + j].bits() != values[i + j].bits();
+
+            auto parts = xsimd::to_float(b);
+            parts[0].store_unaligned(widened.data());
+            parts[1].store_unaligned(widened.data() + size);
+            for (size_t j = 0; j < bf16_size; ++j)
+            {
+                uint32_t bits;
+                std::memcpy(&bits, &widened[j], sizeof(bits));
+                to_float_mismatch += bits != (uint32_t(values[i + j].bits()) << 16);
+            }
+
+            xsimd::to_bfloat16(parts[0], parts[1]).store_aligned(out.data() + i);
+            for (size_t j = 0; j < bf16_size; ++j)
+            {
+                // nan payloads are quieted on the way through float
+                if (std::isnan(float(values[i + j])))
+                    to_bfloat16_mismatch += !std::isnan(float(out[i + j]));
+                else
+                    to_bfloat16_mismatch += out[i + j].bits() != values[i + j].bits();
+            }
+        }
+        {
+            INFO("batch<bfloat16>::load / store");
+            CHECK_EQ(load_store_mismatch, 0u);
+        }
+        {
+            INFO("to_float(batch<bfloat16>)");
+            CHECK_EQ(to_float_mismatch, 0u);
+        }
+        {
+            INFO("to_bfloat16(batch<float>, batch<float>)");
+            CHECK_EQ(to_bfloat16_mismatch, 0u);
+        }
+
+        // narrowing rounds like the scalar conversion
+        std::array<float, 2 * size> floats;
+        std::array<xsimd::bfloat16, 2 * size> narrowed;
+        for (size_t j = 0; j < floats.size(); ++j)
+            floats[j] = from_bits(0x3F800000u + uint32_t(j) * 0x18000u + (j % 2 ? 0x8000u : 0x7FFFu));
+        xsimd::to_bfloat16(batch_type::load_unaligned(floats.data()), batch_type::load_unaligned(floats.data() + size)).store_unaligned(narrowed.data());
+        for (size_t j = 0; j < floats.size(); ++j)
+            CHECK_EQ(narrowed[j].bits(), reference(floats[j]));
+    }
+};
+
+TEST_CASE("[bfloat16]")
+{
+    bfloat16_test Test;
+    SUBCASE("scalar") { Test.test_scalar(); }
+    SUBCASE("load_as") { Test.test_load_as(); }
+    SUBCASE("store_as") { Test.test_store_as(); }
+    SUBCASE("batch") { Test.test_batch(); }
+}
+#endif
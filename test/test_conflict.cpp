@@ -0,0 +1,103 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#include "xsimd/xsimd.hpp"
+#ifndef XSIMD_NO_SUPPORTED_ARCHITECTURE
+
+#include "test_utils.hpp"
+
+template <class B>
+struct conflict_test
+{
+    using batch_type = B;
+    using value_type = typename B::value_type;
+    static constexpr size_t size = B::size;
+
+    void test_conflict() const
+    {
+        // no duplicate, every slot equal, and a few repeating patterns
+        for (size_t period : { size, size_t(1), size_t(2), size_t(3) })
+        {
+            std::array<value_type, size> input;
+            for (size_t i = 0; i < size; ++i)
+                input[i] = static_cast<value_type>(i % period) * 1000 + 7;
+
+            std::array<value_type, size> expected;
+            for (size_t i = 0; i < size; ++i)
+            {
+                uint64_t bits = 0;
+                for (size_t j = 0; j < i; ++j)
+                    bits |= uint64_t(input[j] == input[i]) << j;
+                expected[i] = static_cast<value_type>(bits);
+            }
+
+            auto res = xsimd::conflict(batch_type::load_unaligned(input.data()));
+            INFO("conflict with period ", period);
+            CHECK_BATCH_EQ(res, expected);
+        }
+    }
+};
+
+TEST_CASE_TEMPLATE("[conflict]", B, xsimd::batch<int32_t>, xsimd::batch<uint32_t>, xsimd::batch<int64_t>, xsimd::batch<uint64_t>)
+{
+    conflict_test<B> Test;
+    Test.test_conflict();
+}
+
+template <class B>
+struct scatter_add_test
+{
+    using batch_type = B;
+    using value_type = typename B::value_type;
+    using index_type = xsimd::as_integer_t<value_type>;
+    using index_batch_type = xsimd::batch<index_type, typename B::arch_type>;
+    static constexpr size_t size = B::size;
+    static constexpr size_t nb_bins = 5;
+
+    void test_scatter_add() const
+    {
+        for (size_t period : { size, size_t(1), size_t(2), size_t(3) })
+        {
+            std::array<index_type, size> index;
+            std::array<value_type, size> values;
+            for (size_t i = 0; i < size; ++i)
+            {
+                index[i] = static_cast<index_type>((i % period) % nb_bins);
+                values[i] = static_cast<value_type>(i + 1);
+            }
+
+            // scattered indices on the unit stride path too
+            if (period == size)
+            {
+                for (size_t i = 0; i < size; ++i)
+                    index[i] = static_cast<index_type>((i * 3) % nb_bins);
+            }
+
+            std::array<value_type, nb_bins> expected;
+            std::array<value_type, nb_bins> res;
+            for (size_t i = 0; i < nb_bins; ++i)
+                expected[i] = res[i] = static_cast<value_type>(10 * i);
+            for (size_t i = 0; i < size; ++i)
+                expected[index[i]] += values[i];
+
+            xsimd::scatter_add(res.data(), index_batch_type::load_unaligned(index.data()), batch_type::load_unaligned(values.data()));
+            INFO("scatter_add with period ", period);
+            CHECK_EQ(res, expected);
+        }
+    }
+};
+
+TEST_CASE_TEMPLATE("[scatter_add]", B, BATCH_FLOAT_TYPES, xsimd::batch<int32_t>, xsimd::batch<uint32_t>, xsimd::batch<int64_t>, xsimd::batch<uint64_t>)
+{
+    scatter_add_test<B> Test;
+    Test.test_scatter_add();
+}
+#endif
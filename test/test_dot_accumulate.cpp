@@ -0,0 +1,192 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#include "xsimd/xsimd.hpp"
+#ifndef XSIMD_NO_SUPPORTED_ARCHITECTURE
+
+#include "test_utils.hpp"
+
+struct dot_accumulate_test
+{
+    using acc_batch = xsimd::batch<int32_t>;
+    static constexpr size_t size = acc_batch::size;
+
+    std::array<int32_t, size> acc;
+
+    dot_accumulate_test()
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            acc[i] = static_cast<int32_t>(i * 1000) - 5000;
+        }
+    }
+
+    void test_u8_i8() const
+    {
+        constexpr size_t nb = 4 * size;
+        std::array<uint8_t, nb> x;
+        std::array<int8_t, nb> y;
+        for (size_t i = 0; i < nb; ++i)
+        {
+            // include the extreme values to catch saturating implementations
+            x[i] = (i % 5 == 0) ? 255 : static_cast<uint8_t>(i * 7);
+            y[i] = (i % 3 == 0) ? -128 : static_cast<int8_t>(127 - i * 3);
+        }
+
+        std::array<int32_t, size> expected;
+        for (size_t i = 0; i < size; ++i)
+        {
+            expected[i] = acc[i];
+            for (size_t k = 0; k < 4; ++k)
+                expected[i] += int32_t(x[4 * i + k]) * int32_t(y[4 * i + k]);
+        }
+
+        auto bacc = acc_batch::load_unaligned(acc.data());
+        auto bx = xsimd::batch<uint8_t>::load_unaligned(x.data());
+        auto by = xsimd::batch<int8_t>::load_unaligned(y.data());
+        auto res = xsimd::dot_accumulate(bacc, bx, by);
+        INFO("dot_accumulate(u8, i8)");
+        CHECK_BATCH_EQ(res, expected);
+
+        std::array<uint8_t, nb> xmax;
+        std::array<int8_t, nb> ymin;
+        xmax.fill(255);
+        ymin.fill(-128);
+        auto res_ext = xsimd::dot_accumulate(acc_batch(0), xsimd::batch<uint8_t>::load_unaligned(xmax.data()), xsimd::batch<int8_t>::load_unaligned(ymin.data()));
+        INFO("dot_accumulate(u8, i8) extreme values");
+        CHECK_BATCH_EQ(res_ext, acc_batch(4 * 255 * -128));
+    }
+
+    void test_i16_i16() const
+    {
+        constexpr size_t nb = 2 * size;
+        std::array<int16_t, nb> x;
+        std::array<int16_t, nb> y;
+        for (size_t i = 0; i < nb; ++i)
+        {
+            x[i] = (i % 4 == 0) ? -32768 : static_cast<int16_t>(i * 1021 - 7000);
+            y[i] = (i % 3 == 0) ? 32767 : static_cast<int16_t>(3000 - i * 517);
+        }
+
+        std::array<int32_t, size> expected;
+        for (size_t i = 0; i < size; ++i)
+        {
+            expected[i] = acc[i] + int32_t(x[2 * i]) * int32_t(y[2 * i]) + int32_t(x[2 * i + 1]) * int32_t(y[2 * i + 1]);
+        }
+
+        auto bacc = acc_batch::load_unaligned(acc.data());
+        auto bx = xsimd::batch<int16_t>::load_unaligned(x.data());
+        auto by = xsimd::batch<int16_t>::load_unaligned(y.data());
+        auto res = xsimd::dot_accumulate(bacc, bx, by);
+        INFO("dot_accumulate(i16, i16)");
+        CHECK_BATCH_EQ(res, expected);
+    }
+
+    template <class T_acc, class T_x, class T_y>
+    void test_mmla() const
+    {
+        constexpr size_t nb = 4 * size;
+        std::array<T_acc, size> a;
+        std::array<T_x, nb> x;
+        std::array<T_y, nb> y;
+        for (size_t i = 0; i < size; ++i)
+            a[i] = static_cast<T_acc>(acc[i]);
+        for (size_t i = 0; i < nb; ++i)
+        {
+            x[i] = static_cast<T_x>(i % 7 == 0 ? std::numeric_limits<T_x>::max() : i * 13);
+            y[i] = static_cast<T_y>(i % 5 == 0 ? std::numeric_limits<T_y>::min() : 100 - i * 11);
+        }
+
+        std::array<T_acc, size> expected;
+        for (size_t b = 0; b < size / 4; ++b)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                for (size_t j = 0; j < 2; ++j)
+                {
+                    T_acc res = a[4 * b + 2 * i + j];
+                    for (size_t k = 0; k < 8; ++k)
+                        res += T_acc(x[16 * b + 8 * i + k]) * T_acc(y[16 * b + 8 * j + k]);
+                    expected[4 * b + 2 * i + j] = res;
+                }
+            }
+        }
+
+        auto res = xsimd::mmla(xsimd::batch<T_acc>::load_unaligned(a.data()),
+                               xsimd::batch<T_x>::load_unaligned(x.data()),
+                               xsimd::batch<T_y>::load_unaligned(y.data()));
+        INFO("mmla");
+        CHECK_BATCH_EQ(res, expected);
+    }
+
+    template <class A = xsimd::default_arch>
+    void test_bf16() const
+    {
+        test_bf16<A>(xsimd::has_simd_register<xsimd::bfloat16, A> {});
+    }
+
+    template <class A>
+    void test_bf16(std::false_type) const
+    {
+    }
+
+    template <class A>
+    void test_bf16(std::true_type) const
+    {
+        using float_batch = xsimd::batch<float, A>;
+        using bf16_batch = xsimd::batch<xsimd::bfloat16, A>;
+        constexpr size_t size = float_batch::size;
+        constexpr size_t nb = 2 * size;
+        std::array<float, size> a;
+        std::array<xsimd::bfloat16, nb> x;
+        std::array<xsimd::bfloat16, nb> y;
+        for (size_t i = 0; i < size; ++i)
+            a[i] = static_cast<float>(static_cast<int32_t>(i * 1000) - 5000) / 8.f;
+        for (size_t i = 0; i < nb; ++i)
+        {
+            x[i] = xsimd::bfloat16(static_cast<float>(i * 37 % 101) / 7.f - 6.f);
+            y[i] = xsimd::bfloat16(static_cast<float>(i * 53 % 89) / 3.f - 13.f);
+        }
+
+        std::array<float, size> expected;
+        for (size_t i = 0; i < size; ++i)
+        {
+            float res = a[i];
+            res += float(x[2 * i + 1]) * float(y[2 * i + 1]);
+            res += float(x[2 * i]) * float(y[2 * i]);
+            expected[i] = res;
+        }
+
+        auto res = xsimd::bf16_dot(float_batch::load_unaligned(a.data()),
+                                   bf16_batch::load_unaligned(x.data()),
+                                   bf16_batch::load_unaligned(y.data()));
+        INFO("bf16_dot");
+        CHECK_BATCH_EQ(res, expected);
+    }
+};
+
+TEST_CASE("[dot_accumulate]")
+{
+    dot_accumulate_test Test;
+    SUBCASE("u8_i8") { Test.test_u8_i8(); }
+    SUBCASE("i16_i16") { Test.test_i16_i16(); }
+    SUBCASE("mmla_s8_s8") { Test.test_mmla<int32_t, int8_t, int8_t>(); }
+    SUBCASE("mmla_u8_u8") { Test.test_mmla<uint32_t, uint8_t, uint8_t>(); }
+    SUBCASE("mmla_u8_s8") { Test.test_mmla<int32_t, uint8_t, int8_t>(); }
+    SUBCASE("bf16") { Test.test_bf16(); }
+#if XSIMD_WITH_AVX512BF16
+    if (xsimd::available_architectures().has(xsimd::avx512bf16 {}))
+    {
+        SUBCASE("bf16 avx512bf16") { Test.test_bf16<xsimd::avx512bf16>(); }
+    }
+#endif
+}
+#endif
@@ -0,0 +1,198 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#include "xsimd/xsimd.hpp"
+#ifndef XSIMD_NO_SUPPORTED_ARCHITECTURE
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "test_utils.hpp"
+
+struct float16_test
+{
+    using batch_type = xsimd::batch<float>;
+    static constexpr size_t size = batch_type::size;
+
+    static bool same_value(float lhs, float rhs)
+    {
+        if (std::isnan(lhs) || std::isnan(rhs))
+            return std::isnan(lhs) && std::isnan(rhs);
+        uint32_t l, r;
+        std::memcpy(&l, &lhs, sizeof(l));
+        std::memcpy(&r, &rhs, sizeof(r));
+        return l == r;
+    }
+
+    void test_scalar() const
+    {
+        CHECK_EQ(xsimd::float16(0.f).bits(), 0x0000);
+        CHECK_EQ(xsimd::float16(-0.f).bits(), 0x8000);
+        CHECK_EQ(xsimd::float16(1.f).bits(), 0x3C00);
+        CHECK_EQ(xsimd::float16(-2.f).bits(), 0xC000);
+        CHECK_EQ(xsimd::float16(65504.f).bits(), 0x7BFF);
+        CHECK_EQ(xsimd::float16(65536.f).bits(), 0x7C00);
+        CHECK_EQ(xsimd::float16(-std::numeric_limits<float>::infinity()).bits(), 0xFC00);
+        CHECK_EQ(xsimd::float16(std::ldexp(1.f, -24)).bits(), 0x0001);
+        CHECK_EQ(xsimd::float16(std::ldexp(1.f, -26)).bits(), 0x0000);
+        // ties round to even
+        CHECK_EQ(xsimd::float16(1.f + std::ldexp(1.f, -11)).bits(), 0x3C00);
+        CHECK_EQ(xsimd::float16(1.f + 3.f * std::ldexp(1.f, -11)).bits(), 0x3C02);
+        CHECK(std::isnan(float(xsimd::float16(std::numeric_limits<float>::quiet_NaN()))));
+        CHECK_EQ(float(xsimd::float16::from_bits(0x3555)), 0.333251953125f);
+    }
+
+    void test_load_as() const
+    {
+        std::vector<xsimd::float16, xsimd::aligned_allocator<xsimd::float16, batch_type::arch_type::alignment()>> halves(1u << 16);
+        for (uint32_t i = 0; i < halves.size(); ++i)
+            halves[i] = xsimd::float16::from_bits(static_cast<uint16_t>(i));
+
+        std::array<float, size> res;
+        size_t mismatch = 0;
+        for (size_t i = 0; i < halves.size(); i += size)
+        {
+            auto b = (i / size) % 2 ? xsimd::load_as<float>(halves.data() + i, xsimd::aligned_mode())
+                                    : xsimd::load_as<float>(halves.data() + i, xsimd::unaligned_mode());
+            b.store_unaligned(res.data());
+            for (size_t j = 0; j < size; ++j)
+                mismatch += !same_value(res[j], float(halves[i + j]));
+        }
+        INFO("load_as<float>(float16 const*)");
+        CHECK_EQ(mismatch, 0u);
+    }
+
+    void test_store_as() const
+    {
+        // every finite half survives a float round trip
+        std::vector<float> floats;
+        for (uint32_t i = 0; i < (1u << 16); ++i)
+        {
+            if ((i & 0x7C00u) != 0x7C00u)
+                floats.push_back(float(xsimd::float16::from_bits(static_cast<uint16_t>(i))));
+        }
+        // plus values that exercise rounding, overflow and underflow
+        uint32_t seed = 12345;
+        for (size_t i = 0; i < 4096; ++i)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            float f;
+            uint32_t bits = (seed & 0x8FFFFFFFu) | 0x30000000u;
+            std::memcpy(&f, &bits, sizeof(f));
+            floats.push_back(f);
+        }
+        floats.resize(floats.size() - floats.size() % size);
+
+        std::vector<xsimd::float16, xsimd::aligned_allocator<xsimd::float16, batch_type::arch_type::alignment()>> out(floats.size());
+        size_t mismatch = 0;
+        for (size_t i = 0; i < floats.size(); i += size)
+        {
+            auto b = batch_type::load_unaligned(floats.data() + i);
+            if ((i / size) % 2)
+                xsimd::store_as(out.data() + i, b, xsimd::aligned_mode());
+            else
+                xsimd::store_as(out.data() + i, b, xsimd::unaligned_mode());
+            for (size_t j = 0; j < size; ++j)
+                mismatch += out[i + j].bits() != xsimd::float16(floats[i + j]).bits();
+        }
+        INFO("store_as(float16*, batch<float>)");
+        CHECK_EQ(mismatch, 0u);
+
+        std::array<xsimd::float16, size> nan_out;
+        xsimd::store_as(nan_out.data(), batch_type(std::numeric_limits<float>::quiet_NaN()), xsimd::unaligned_mode());
+        for (size_t j = 0; j < size; ++j)
+            CHECK(std::isnan(float(nan_out[j])));
+    }
+
+    void test_batch() const
+    {
+        test_batch<batch_type::arch_type>(xsimd::has_simd_register<xsimd::float16, batch_type::arch_type> {});
+    }
+
+    template <class A>
+    void test_batch(std::false_type) const
+    {
+    }
+
+    template <class A>
+    void test_batch(std::true_type) const
+    {
+        using half_batch = xsimd::batch<xsimd::float16, A>;
+        constexpr size_t half_size = half_batch::size;
+        static_assert(half_size == 2 * size, "a float16 batch holds two float batches");
+
+        std::vector<xsimd::float16, xsimd::aligned_allocator<xsimd::float16, A::alignment()>> halves(1u << 16), out(1u << 16);
+        for (uint32_t i = 0; i < halves.size(); ++i)
+            halves[i] = xsimd::float16::from_bits(static_cast<uint16_t>(i));
+
+        std::array<float, 2 * size> widened;
+        size_t load_store_mismatch = 0, to_float_mismatch = 0, to_float16_mismatch = 0;
+        for (size_t i = 0; i < halves.size(); i += half_size)
+        {
+            half_batch b = (i / half_size) % 2 ? half_batch::load_aligned(halves.data() + i)
+                                               : half_batch::load_unaligned(halves.data() + i);
+            if ((i / half_size) % 2)
+                b.store_unaligned(out.data() + i);
+            else
+                b.store_aligned(out.data() + i);
+            for (size_t j = 0; j < half_size; ++j)
+                load_store_mismatch += out[i + j].bits() != halves[i + j].bits();
+
+            auto parts = xsimd::to_float(b);
+            parts[0].store_unaligned(widened.data());
+            parts[1].store_unaligned(widened.data() + size);
+            for (size_t j = 0; j < half_size; ++j)
+                to_float_mismatch += !same_value(widened[j], float(halves[i + j]));
+
+            xsimd::to_float16(parts[0], parts[1]).store_aligned(out.data() + i);
+            for (size_t j = 0; j < half_size; ++j)
+            {
+                // NaN payloads may be quietened on the way through float
+                if (std::isnan(float(halves[i + j])))
+                    to_float16_mismatch += !std::isnan(float(out[i + j]));
+                else
+                    to_float16_mismatch += out[i + j].bits() != halves[i + j].bits();
+            }
+        }
+        {
+            INFO("batch<float16>::load / store");
+            CHECK_EQ(load_store_mismatch, 0u);
+        }
+        {
+            INFO("to_float(batch<float16>)");
+            CHECK_EQ(to_float_mismatch, 0u);
+        }
+        {
+            INFO("to_float16(batch<float>, batch<float>)");
+            CHECK_EQ(to_float16_mismatch, 0u);
+        }
+
+        // narrowing rounds like the scalar conversion
+        std::array<float, 2 * size> floats;
+        std::array<xsimd::float16, 2 * size> narrowed;
+        for (size_t j = 0; j < floats.size(); ++j)
+            floats[j] = 1.f + float(2 * j + 1) * std::ldexp(1.f, -11);
+        xsimd::to_float16(batch_type::load_unaligned(floats.data()), batch_type::load_unaligned(floats.data() + size)).store_unaligned(narrowed.data());
+        for (size_t j = 0; j < floats.size(); ++j)
+            CHECK_EQ(narrowed[j].bits(), xsimd::float16(floats[j]).bits());
+    }
+};
+
+TEST_CASE("[float16]")
+{
+    float16_test Test;
+    SUBCASE("scalar") { Test.test_scalar(); }
+    SUBCASE("load_as") { Test.test_load_as(); }
+    SUBCASE("store_as") { Test.test_store_as(); }
+    SUBCASE("batch") { Test.test_batch(); }
+}
+#endif
@@ -12,6 +12,8 @@
 #include "xsimd/xsimd.hpp"
 #ifndef XSIMD_NO_SUPPORTED_ARCHITECTURE
 
+#include <algorithm>
+#include <limits>
 #include <random>
 
 #include "test_utils.hpp"
@@ -156,7 +158,160 @@ struct load_store_test
 #endif
     }
 
+    void test_masked()
+    {
+        array_type data, res;
+        std::array<bool, size> selected;
+        for (size_t i = 0; i < size; ++i)
+        {
+            data[i] = static_cast<value_type>(i + 1);
+            selected[i] = (i % 3) == 0;
+            expected[i] = selected[i] ? data[i] : value_type(0);
+        }
+        auto mask = xsimd::batch_bool<value_type, typename B::arch_type>::load_unaligned(selected.data());
+
+        batch_type b = xsimd::load_masked(data.data(), mask);
+        INFO("load_masked");
+        CHECK_BATCH_EQ(b, expected);
+
+        res.fill(value_type(0));
+        xsimd::store_masked(res.data(), batch_type::load_unaligned(data.data()), mask);
+        INFO("store_masked");
+        CHECK_BATCH_EQ(batch_type::load_unaligned(res.data()), expected);
+    }
+
+    void test_partial()
+    {
+        array_type data, res;
+        for (size_t i = 0; i < size; ++i)
+            data[i] = static_cast<value_type>(i + 1);
+
+        for (size_t n = 0; n <= size; ++n)
+        {
+            for (size_t i = 0; i < size; ++i)
+                expected[i] = i < n ? data[i] : value_type(0);
+
+            batch_type b = xsimd::load_partial<typename B::arch_type>(data.data(), n);
+            INFO("load_partial of ", n, " elements");
+            CHECK_BATCH_EQ(b, expected);
+
+            res.fill(value_type(0));
+            xsimd::store_partial(res.data(), batch_type::load_unaligned(data.data()), n);
+            INFO("store_partial of ", n, " elements");
+            CHECK_BATCH_EQ(batch_type::load_unaligned(res.data()), expected);
+        }
+    }
+
+    void test_interleaved()
+    {
+        test_interleaved_impl<1>();
+        test_interleaved_impl<2>();
+        test_interleaved_impl<3>();
+        test_interleaved_impl<4>();
+        test_interleaved_impl<5>();
+    }
+
+    void test_strided()
+    {
+        test_strided_impl<1>();
+        test_strided_impl<2>();
+        test_strided_impl<3>();
+        test_strided_impl<5>();
+        test_strided_impl<16>();
+        // wider than any batch
+        test_strided_impl<67>();
+
+        test_strided_runtime(4);
+        test_strided_runtime(-3);
+        test_strided_runtime(0);
+    }
+
+    void test_stream()
+    {
+        using vector_type = std::vector<value_type, allocator<value_type>>;
+        vector_type res(4 * size);
+        for (size_t i = 0; i < res.size(); i += size)
+        {
+            xsimd::prefetch(res.data() + i);
+            xsimd::prefetch<0>(res.data() + i);
+            for (size_t j = 0; j < size; ++j)
+                expected[j] = static_cast<value_type>(i / size + j);
+            xsimd::store_stream(res.data() + i, batch_type::load_unaligned(expected.data()));
+        }
+        xsimd::stream_fence<typename B::arch_type>();
+
+        for (size_t i = 0; i < res.size(); i += size)
+        {
+            for (size_t j = 0; j < size; ++j)
+                expected[j] = static_cast<value_type>(i / size + j);
+            INFO("store_stream at offset ", i);
+            CHECK_BATCH_EQ(batch_type::load_aligned(res.data() + i), expected);
+        }
+    }
+
 private:
+    template <size_t N>
+    void test_interleaved_impl()
+    {
+        // one element of offset to exercise unaligned accesses
+        std::vector<value_type> data(N * size + 1), res(N * size + 1, value_type(0));
+        for (size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<value_type>((i * 7) % 101 + 1);
+
+        std::array<batch_type, N> channels = xsimd::load_interleaved<N, typename B::arch_type>(data.data() + 1);
+        for (size_t c = 0; c < N; ++c)
+        {
+            for (size_t j = 0; j < size; ++j)
+                expected[j] = data[1 + j * N + c];
+            INFO("load_interleaved<", N, "> channel ", c);
+            CHECK_BATCH_EQ(channels[c], expected);
+        }
+
+        xsimd::store_interleaved(res.data() + 1, channels);
+        INFO("store_interleaved<", N, ">");
+        CHECK((res[0] == value_type(0) && std::equal(data.begin() + 1, data.end(), res.begin() + 1)));
+    }
+
+    template <size_t Stride>
+    void test_strided_impl()
+    {
+        // exactly the elements up to the last one accessed
+        std::vector<value_type> data((size - 1) * Stride + 1), res(data.size(), value_type(0));
+        for (size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<value_type>((i * 7) % 101 + 1);
+        for (size_t j = 0; j < size; ++j)
+            expected[j] = data[j * Stride];
+
+        INFO("load_strided<", Stride, ">");
+        CHECK_BATCH_EQ((xsimd::load_strided<Stride, typename B::arch_type>(data.data())), expected);
+        CHECK_BATCH_EQ(xsimd::load_strided<typename B::arch_type>(data.data(), Stride), expected);
+
+        xsimd::store_strided<Stride>(res.data(), batch_type::load_unaligned(expected.data()));
+        bool success = true;
+        for (size_t i = 0; i < res.size(); ++i)
+            success = success && res[i] == (i % Stride == 0 ? data[i] : value_type(0));
+        INFO("store_strided<", Stride, ">");
+        CHECK(success);
+    }
+
+    void test_strided_runtime(std::ptrdiff_t stride)
+    {
+        size_t extent = (size - 1) * static_cast<size_t>(stride < 0 ? -stride : stride) + 1;
+        std::vector<value_type> data(extent), res(extent, value_type(0));
+        for (size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<value_type>((i * 7) % 101 + 1);
+        std::ptrdiff_t first = stride < 0 ? static_cast<std::ptrdiff_t>(extent) - 1 : 0;
+        for (size_t j = 0; j < size; ++j)
+            expected[j] = data[first + static_cast<std::ptrdiff_t>(j) * stride];
+
+        INFO("load_strided with stride ", stride);
+        CHECK_BATCH_EQ(xsimd::load_strided<typename B::arch_type>(data.data() + first, stride), expected);
+
+        batch_type b = batch_type::load_unaligned(expected.data());
+        xsimd::store_strided(res.data() + first, b, stride);
+        CHECK_BATCH_EQ(xsimd::load_strided<typename B::arch_type>(res.data() + first, stride), expected);
+    }
+
 #ifdef XSIMD_WITH_SSE2
     struct test_load_as_return_type
     {
@@ -240,6 +395,20 @@ private:
         b = batch_type::gather(v.data(), index);
         INFO(name, " (in reverse order)");
         CHECK_BATCH_EQ(b, expected);
+
+        // the odd slots are masked out, their index is far out of bounds
+        std::copy(v.cbegin(), v.cend(), expected.begin());
+        for (size_t i = 1; i < size; i += 2)
+        {
+            index_reverse[i] = std::numeric_limits<typename index_type::value_type>::max();
+            expected[i] = value_type(3);
+        }
+        for (size_t i = 0; i < size; i += 2)
+            index_reverse[i] = static_cast<typename index_type::value_type>(i);
+        index = index_type::load_unaligned(index_reverse.data());
+        b = batch_type::gather(v.data(), index, batch_type::batch_bool_type::from_mask(0x5555555555555555ull >> (64 - size)), batch_type(value_type(3)));
+        INFO(name, " (masked)");
+        CHECK_BATCH_EQ(b, expected);
     }
 
     template <class V>
@@ -294,5 +463,15 @@ TEST_CASE_TEMPLATE("[load store]", B, BATCH_TYPES)
     SUBCASE("gather") { Test.test_gather(); }
 
     SUBCASE("scatter") { Test.test_scatter(); }
+
+    SUBCASE("masked") { Test.test_masked(); }
+
+    SUBCASE("partial") { Test.test_partial(); }
+
+    SUBCASE("stream") { Test.test_stream(); }
+
+    SUBCASE("interleaved") { Test.test_interleaved(); }
+
+    SUBCASE("strided") { Test.test_strided(); }
 }
 #endif
@@ -0,0 +1,125 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#include "xsimd/xsimd.hpp"
+#ifndef XSIMD_NO_SUPPORTED_ARCHITECTURE
+
+#include "test_utils.hpp"
+
+namespace
+{
+    // portable 64x64 -> 128 bit reference multiplication
+    void mul_wide(uint64_t x, uint64_t y, uint64_t& lo, uint64_t& hi)
+    {
+        uint64_t x_lo = x & 0xFFFFFFFFull, x_hi = x >> 32;
+        uint64_t y_lo = y & 0xFFFFFFFFull, y_hi = y >> 32;
+        uint64_t lo_lo = x_lo * y_lo, lo_hi = x_lo * y_hi;
+        uint64_t hi_lo = x_hi * y_lo, hi_hi = x_hi * y_hi;
+        uint64_t mid = (lo_lo >> 32) + (lo_hi & 0xFFFFFFFFull) + (hi_lo & 0xFFFFFFFFull);
+        lo = (mid << 32) | (lo_lo & 0xFFFFFFFFull);
+        hi = hi_hi + (lo_hi >> 32) + (hi_lo >> 32) + (mid >> 32);
+    }
+}
+
+struct madd52_test
+{
+    using batch_type = xsimd::batch<uint64_t>;
+    static constexpr size_t size = batch_type::size;
+    static constexpr uint64_t mask52 = (1ull << 52) - 1;
+
+    std::vector<uint64_t> lhs;
+    std::vector<uint64_t> rhs;
+    std::vector<uint64_t> acc;
+
+    madd52_test()
+    {
+        const uint64_t specials[] = { 0, 1, mask52, mask52 + 1, ~uint64_t(0), 0x8000000000000000ull, 0xFFFFFFFFull, 0x100000000ull };
+        uint64_t state = 0x9E3779B97F4A7C15ull;
+        for (uint64_t x : specials)
+        {
+            for (uint64_t y : specials)
+            {
+                lhs.push_back(x);
+                rhs.push_back(y);
+                acc.push_back(state);
+                state = state * 6364136223846793005ull + 1442695040888963407ull;
+            }
+        }
+        for (size_t i = 0; i < 256; ++i)
+        {
+            lhs.push_back(state);
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            rhs.push_back(state);
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            acc.push_back(state);
+        }
+        while (lhs.size() % size)
+        {
+            lhs.push_back(0);
+            rhs.push_back(0);
+            acc.push_back(0);
+        }
+    }
+
+    void test_madd52() const
+    {
+        std::vector<uint64_t> expected_lo(lhs.size()), expected_hi(lhs.size());
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            uint64_t lo, hi;
+            mul_wide(lhs[i] & mask52, rhs[i] & mask52, lo, hi);
+            expected_lo[i] = acc[i] + (lo & mask52);
+            expected_hi[i] = acc[i] + ((hi << 12) | (lo >> 52));
+        }
+
+        std::vector<uint64_t> res_lo(lhs.size()), res_hi(lhs.size());
+        for (size_t i = 0; i < lhs.size(); i += size)
+        {
+            auto z = batch_type::load_unaligned(&acc[i]);
+            auto x = batch_type::load_unaligned(&lhs[i]);
+            auto y = batch_type::load_unaligned(&rhs[i]);
+            xsimd::madd52lo(z, x, y).store_unaligned(&res_lo[i]);
+            xsimd::madd52hi(z, x, y).store_unaligned(&res_hi[i]);
+        }
+        INFO("madd52lo");
+        CHECK_EQ(detail::get_nb_diff(res_lo, expected_lo), 0);
+        INFO("madd52hi");
+        CHECK_EQ(detail::get_nb_diff(res_hi, expected_hi), 0);
+    }
+
+    void test_mul_hi() const
+    {
+        std::vector<uint64_t> expected(lhs.size());
+        for (size_t i = 0; i < lhs.size(); ++i)
+        {
+            uint64_t lo;
+            mul_wide(lhs[i], rhs[i], lo, expected[i]);
+        }
+
+        std::vector<uint64_t> res(lhs.size());
+        for (size_t i = 0; i < lhs.size(); i += size)
+        {
+            auto x = batch_type::load_unaligned(&lhs[i]);
+            auto y = batch_type::load_unaligned(&rhs[i]);
+            xsimd::mul_hi(x, y).store_unaligned(&res[i]);
+        }
+        INFO("mul_hi");
+        CHECK_EQ(detail::get_nb_diff(res, expected), 0);
+    }
+};
+
+TEST_CASE("[madd52]")
+{
+    madd52_test Test;
+    SUBCASE("madd52") { Test.test_madd52(); }
+    SUBCASE("mul_hi") { Test.test_mul_hi(); }
+}
+#endif
@@ -0,0 +1,156 @@
+/***************************************************************************
+ * Copyright (c) Johan Mabille, Sylvain Corlay, Wolf Vollprecht and         *
+ * Martin Renou                                                             *
+ * Copyright (c) QuantStack                                                 *
+ * Copyright (c) Serge Guelton                                              *
+ *                                                                          *
+ * Distributed under the terms of the BSD 3-Clause License.                 *
+ *                                                                          *
+ * The full license is in the file LICENSE, distributed with this software. *
+ ****************************************************************************/
+
+#include "xsimd/xsimd.hpp"
+#ifndef XSIMD_NO_SUPPORTED_ARCHITECTURE
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "xsimd/stl/parallel.hpp"
+
+#include "test_utils.hpp"
+
+namespace
+{
+    struct square_plus_one
+    {
+        template <class T, class A>
+        xsimd::batch<T, A> operator()(xsimd::batch<T, A> const& x) const
+        {
+            return x * x + xsimd::batch<T, A>(T(1));
+        }
+    };
+
+    struct difference
+    {
+        template <class T, class A>
+        xsimd::batch<T, A> operator()(xsimd::batch<T, A> const& x, xsimd::batch<T, A> const& y) const
+        {
+            return x - y;
+        }
+    };
+
+    struct maximum
+    {
+        template <class T>
+        T operator()(T const& x, T const& y) const
+        {
+            return xsimd::max(x, y);
+        }
+    };
+}
+
+template <class T>
+struct parallel_test
+{
+    using vector_type = std::vector<T, xsimd::default_allocator<T>>;
+
+    // several blocks per thread with a partial last block
+    static constexpr size_t size = 7 * XSIMD_PARALLEL_BLOCK_SIZE / sizeof(T) + 13;
+
+    static vector_type make_input(size_t n)
+    {
+        vector_type v(n);
+        for (size_t i = 0; i < n; ++i)
+            v[i] = static_cast<T>((i * 7 + 3) % 11);
+        return v;
+    }
+
+    void test_thread_pool() const
+    {
+        xsimd::parallel::thread_pool pool(4);
+        CHECK_GE(pool.concurrency(), 1u);
+
+        std::vector<std::atomic<int>> calls(1000);
+        for (auto& c : calls)
+            c = 0;
+        pool.bulk_execute(calls.size(), [&calls](size_t i)
+                          { ++calls[i]; });
+        size_t wrong = 0;
+        for (auto const& c : calls)
+            wrong += c != 1;
+        CHECK_EQ(wrong, 0u);
+
+        // nested jobs run sequentially instead of deadlocking
+        std::atomic<int> nested(0);
+        pool.bulk_execute(8, [&pool, &nested](size_t)
+                          { pool.bulk_execute(4, [&nested](size_t)
+                                              { ++nested; }); });
+        CHECK_EQ(nested.load(), 32);
+
+#if defined(_CPPUNWIND) || defined(__cpp_exceptions)
+        bool thrown = false;
+        try
+        {
+            pool.bulk_execute(16, [](size_t i)
+                              { if (i == 5) throw std::runtime_error("task failure"); });
+        }
+        catch (std::runtime_error const&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+#endif
+    }
+
+    void test_transform() const
+    {
+        xsimd::parallel::thread_pool pool(4);
+        for (size_t offset = 0; offset < 2; ++offset)
+        {
+            vector_type in = make_input(size + offset);
+            vector_type out(size), expected(size);
+            xsimd::transform(in.begin() + offset, in.end(), expected.begin(), square_plus_one());
+            auto end = xsimd::parallel::transform(pool, in.begin() + offset, in.end(), out.begin(), square_plus_one());
+            INFO("offset: ", offset);
+            CHECK((end == out.end()));
+            CHECK((out == expected));
+
+            std::fill(out.begin(), out.end(), T(0));
+            xsimd::parallel::transform(in.begin() + offset, in.end(), in.begin(), out.begin(), difference());
+            size_t mismatch = 0;
+            for (size_t i = 0; i < size; ++i)
+                mismatch += out[i] != static_cast<T>(in[i + offset] - in[i]);
+            CHECK_EQ(mismatch, 0u);
+        }
+    }
+
+    void test_reduce() const
+    {
+        xsimd::parallel::thread_pool pool(4), single(1);
+        for (size_t offset = 0; offset < 2; ++offset)
+        {
+            vector_type in = make_input(size + offset);
+            T expected = T(1);
+            T expected_max = T(0);
+            for (size_t i = offset; i < in.size(); ++i)
+            {
+                expected = static_cast<T>(expected + in[i]);
+                expected_max = std::max(expected_max, in[i]);
+            }
+            INFO("offset: ", offset);
+            CHECK_EQ(xsimd::parallel::reduce(pool, in.begin() + offset, in.end(), T(1)), expected);
+            CHECK_EQ(xsimd::parallel::reduce(single, in.begin() + offset, in.end(), T(1)), expected);
+            CHECK_EQ(xsimd::parallel::reduce(in.begin() + offset, in.end(), T(0), maximum()), expected_max);
+        }
+    }
+};
+
+TEST_CASE_TEMPLATE("[parallel algorithms]", T, float, double, int32_t, uint8_t)
+{
+    parallel_test<T> Test;
+    SUBCASE("thread_pool") { Test.test_thread_pool(); }
+    SUBCASE("transform") { Test.test_transform(); }
+    SUBCASE("reduce") { Test.test_reduce(); }
+}
+#endif
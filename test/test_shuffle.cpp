@@ -14,7 +14,9 @@
 
 #include "test_utils.hpp"
 
+#include <algorithm>
 #include <numeric>
+#include <vector>
 
 namespace
 {
@@ -345,6 +347,37 @@ struct compress_test
             mask_batch_type::load_unaligned(mask.data()));
         CHECK_BATCH_EQ(b, expected);
     }
+
+    void store()
+    {
+        // every mask on small batches, a sample of them on larger ones
+        size_t count = size < 10 ? (size_t(1) << size) : 1024;
+        for (size_t m = 0; m < count; ++m)
+        {
+            uint64_t bits = size < 10 ? m : (m * 0x9E3779B97F4A7C15ull) >> (64 - size);
+            std::array<value_type, size + 1> res;
+            std::fill(res.begin(), res.end(), value_type(42));
+            size_t written = xsimd::compress_store(res.data(), batch_type::load_unaligned(input.data()), mask_batch_type::from_mask(bits));
+
+            size_t expected_written = 0;
+            size_t mismatch = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                if ((bits >> i) & 1u)
+                    mismatch += res[expected_written++] != input[i];
+            }
+            for (size_t i = expected_written; i < res.size(); ++i)
+                mismatch += res[i] != value_type(42);
+            INFO("mask: ", bits);
+            CHECK_EQ(written, expected_written);
+            CHECK_EQ(mismatch, 0u);
+
+            // the register version packs the same elements, then zeros
+            std::copy(res.begin(), res.begin() + written, expected.begin());
+            std::fill(expected.begin() + written, expected.end(), value_type(0));
+            CHECK_BATCH_EQ(xsimd::compress(batch_type::load_unaligned(input.data()), mask_batch_type::from_mask(bits)), expected);
+        }
+    }
 };
 
 TEST_CASE_TEMPLATE("[compress]", B, BATCH_FLOAT_TYPES, xsimd::batch<uint32_t>, xsimd::batch<int32_t>, xsimd::batch<uint64_t>, xsimd::batch<int64_t>)
@@ -358,6 +391,10 @@ TEST_CASE_TEMPLATE("[compress]", B, BATCH_FLOAT_TYPES, xsimd::batch<uint32_t>, x
     {
         Test.full();
     }
+    SUBCASE("store")
+    {
+        Test.store();
+    }
     // SUBCASE("interleave")
     //{
     //     Test.interleave();
@@ -441,6 +478,36 @@ struct expand_test
             mask_batch_type::load_unaligned(mask.data()));
         CHECK_BATCH_EQ(b, expected);
     }
+
+    void load()
+    {
+        // every mask on small batches, a sample of them on larger ones
+        size_t count = size < 10 ? (size_t(1) << size) : 1024;
+        batch_type src(value_type(42));
+        for (size_t m = 0; m < count; ++m)
+        {
+            uint64_t bits = size < 10 ? m : (m * 0x9E3779B97F4A7C15ull) >> (64 - size);
+            // exactly the selected elements, so that reading past them
+            // is caught by the sanitizers
+            std::vector<value_type> packed;
+            for (size_t i = 0; i < size; ++i)
+            {
+                if ((bits >> i) & 1u)
+                    packed.push_back(input[size - 1 - packed.size()]);
+            }
+            std::array<value_type, size> expected_src;
+            for (size_t i = 0, j = 0; i < size; ++i)
+            {
+                bool selected = (bits >> i) & 1u;
+                expected[i] = selected ? packed[j] : value_type(0);
+                expected_src[i] = selected ? packed[j] : value_type(42);
+                j += selected;
+            }
+            INFO("mask: ", bits);
+            CHECK_BATCH_EQ(xsimd::expand_load(packed.data(), mask_batch_type::from_mask(bits)), expected);
+            CHECK_BATCH_EQ(xsimd::expand_load(packed.data(), mask_batch_type::from_mask(bits), src), expected_src);
+        }
+    }
 };
 
 TEST_CASE_TEMPLATE("[expand]", B, BATCH_FLOAT_TYPES, xsimd::batch<uint32_t>, xsimd::batch<int32_t>, xsimd::batch<uint64_t>, xsimd::batch<int64_t>)
@@ -462,6 +529,21 @@ TEST_CASE_TEMPLATE("[expand]", B, BATCH_FLOAT_TYPES, xsimd::batch<uint32_t>, xsi
     {
         Test.generic();
     }
+    SUBCASE("load")
+    {
+        Test.load();
+    }
+}
+
+// 8 and 16 bit elements have no expand kernel and go through the generic
+// expand_load
+TEST_CASE_TEMPLATE("[expand_load]", B, xsimd::batch<uint8_t>, xsimd::batch<int16_t>)
+{
+    expand_test<B> Test;
+    SUBCASE("load")
+    {
+        Test.load();
+    }
 }
 
 template <class B>
@@ -700,4 +782,170 @@ TEST_CASE_TEMPLATE("[shuffle]", B, BATCH_FLOAT_TYPES, xsimd::batch<uint32_t>, xs
     }
 }
 
+template <class B>
+struct sort_test
+{
+    using batch_type = B;
+    using value_type = typename B::value_type;
+    static constexpr size_t size = B::size;
+    std::array<value_type, size> lhs;
+    std::array<value_type, size> rhs;
+
+    sort_test()
+    {
+        // duplicates, negative values for signed types
+        for (size_t i = 0; i < size; ++i)
+        {
+            lhs[i] = static_cast<value_type>((i * 5 + 3) % 7) - static_cast<value_type>(std::is_signed<value_type>::value ? 3 : 0);
+            rhs[i] = static_cast<value_type>((i * 3 + 1) % 11);
+        }
+    }
+
+    void sort()
+    {
+        std::array<value_type, size> ref = lhs;
+        std::sort(ref.begin(), ref.end());
+        INFO("sort");
+        B b_res = xsimd::sort(B::load_unaligned(lhs.data()));
+        CHECK_BATCH_EQ(b_res, ref);
+
+        INFO("sort reversed");
+        std::array<value_type, size> reversed(ref);
+        std::reverse(reversed.begin(), reversed.end());
+        b_res = xsimd::sort(B::load_unaligned(reversed.data()));
+        CHECK_BATCH_EQ(b_res, ref);
+    }
+
+    void merge()
+    {
+        std::array<value_type, size> sorted_lhs = lhs, sorted_rhs = rhs;
+        std::sort(sorted_lhs.begin(), sorted_lhs.end());
+        std::sort(sorted_rhs.begin(), sorted_rhs.end());
+        std::array<value_type, 2 * size> ref;
+        std::merge(sorted_lhs.begin(), sorted_lhs.end(), sorted_rhs.begin(), sorted_rhs.end(), ref.begin());
+        std::array<value_type, size> ref_lo, ref_hi;
+        std::copy(ref.begin(), ref.begin() + size, ref_lo.begin());
+        std::copy(ref.begin() + size, ref.end(), ref_hi.begin());
+
+        B b_lo = B::load_unaligned(sorted_lhs.data());
+        B b_hi = B::load_unaligned(sorted_rhs.data());
+        xsimd::merge(b_lo, b_hi);
+        INFO("merge");
+        CHECK_BATCH_EQ(b_lo, ref_lo);
+        CHECK_BATCH_EQ(b_hi, ref_hi);
+    }
+};
+
+TEST_CASE_TEMPLATE("[sort]", B, BATCH_FLOAT_TYPES, xsimd::batch<uint32_t>, xsimd::batch<int32_t>, xsimd::batch<uint64_t>, xsimd::batch<int64_t>)
+{
+    sort_test<B> Test;
+    SUBCASE("sort")
+    {
+        Test.sort();
+    }
+    SUBCASE("merge")
+    {
+        Test.merge();
+    }
+}
+
+template <class B>
+struct lookup_test
+{
+    using batch_type = B;
+    using value_type = typename B::value_type;
+    using arch_type = typename B::arch_type;
+    using index_type = xsimd::batch<uint8_t, arch_type>;
+    static constexpr size_t size = B::size;
+    std::array<value_type, 2 * size> table;
+    std::array<uint8_t, size> index;
+
+    lookup_test()
+    {
+        for (size_t i = 0; i < 2 * size; ++i)
+            table[i] = static_cast<value_type>(3 * i + 1);
+        for (size_t i = 0; i < size; ++i)
+            index[i] = static_cast<uint8_t>((i * 7 + 5) % (2 * size));
+    }
+
+    void lookup()
+    {
+        B b_lo = B::load_unaligned(table.data());
+        B b_hi = B::load_unaligned(table.data() + size);
+
+        std::array<value_type, size> ref;
+        for (size_t i = 0; i < size; ++i)
+            ref[i] = table[index[i]];
+
+        INFO("lookup");
+        B b_res = xsimd::lookup(b_lo, b_hi, index_type::load_unaligned(index.data()));
+        CHECK_BATCH_EQ(b_res, ref);
+    }
+
+    void swizzle()
+    {
+        B b_lo = B::load_unaligned(table.data());
+
+        // indices span the whole batch, not only the current 128-bit lane
+        std::array<uint8_t, size> swizzle_index;
+        std::array<value_type, size> ref;
+        for (size_t i = 0; i < size; ++i)
+        {
+            swizzle_index[i] = static_cast<uint8_t>(index[i] % size);
+            ref[i] = table[swizzle_index[i]];
+        }
+
+        INFO("swizzle");
+        B b_res = xsimd::swizzle(b_lo, index_type::load_unaligned(swizzle_index.data()));
+        CHECK_BATCH_EQ(b_res, ref);
+    }
+
+    void shuffle()
+    {
+        B b_lo = B::load_unaligned(table.data());
+        B b_hi = B::load_unaligned(table.data() + size);
+
+        struct odd_reverse_generator
+        {
+            static constexpr size_t get(size_t index, size_t size)
+            {
+                return 2 * size - 1 - 2 * index;
+            }
+        };
+
+        std::array<value_type, size> ref;
+        for (size_t i = 0; i < size; ++i)
+            ref[i] = table[odd_reverse_generator::get(i, size)];
+
+        INFO("shuffle");
+        B b_res = xsimd::shuffle(b_lo, b_hi, xsimd::make_batch_constant<uint8_t, arch_type, odd_reverse_generator>());
+        CHECK_BATCH_EQ(b_res, ref);
+    }
+};
+
+TEST_CASE_TEMPLATE("[lookup]", B, xsimd::batch<uint8_t>, xsimd::batch<int8_t>)
+{
+    lookup_test<B> Test;
+    Test.lookup();
+}
+
+#if XSIMD_WITH_AVX512VBMI
+TEST_CASE_TEMPLATE("[avx512vbmi byte permute]", B, xsimd::batch<uint8_t, xsimd::avx512vbmi>, xsimd::batch<int8_t, xsimd::avx512vbmi>)
+{
+    lookup_test<B> Test;
+    SUBCASE("lookup")
+    {
+        Test.lookup();
+    }
+    SUBCASE("swizzle")
+    {
+        Test.swizzle();
+    }
+    SUBCASE("shuffle")
+    {
+        Test.shuffle();
+    }
+}
+#endif
+
 #endif